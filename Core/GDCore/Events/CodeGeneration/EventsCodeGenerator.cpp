@@ -736,10 +736,11 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
   for (auto object : context.GetObjectsListsToBeDeclared()) {
     gd::String objectListDeclaration = "";
     if (!context.ObjectAlreadyDeclared(object)) {
+      // The list of all the instances is copied (and not referenced) as the
+      // conditions of the event pick objects by removing them from the list.
       objectListDeclaration = "std::vector<RuntimeObject*> " +
-                              GetObjectListName(object, context) +
-                              " = runtimeContext->GetObjectsRawPointers(\"" +
-                              ConvertToString(object) + "\");\n";
+                              GetObjectListName(object, context) + " = " +
+                              GenerateAllInstancesGetter(object) + ";\n";
       context.SetObjectDeclared(object);
     } else
       objectListDeclaration = declareObjectList(object, context);
@@ -761,6 +762,12 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
   return declarationsCode;
 }
 
+gd::String EventsCodeGenerator::GenerateAllInstancesGetter(
+    const gd::String& objectName) {
+  return "runtimeContext->GetObjectsRawPointers(" +
+         ConvertToStringExplicit(objectName) + ")";
+}
+
 /**
  * Generate events list code.
  */
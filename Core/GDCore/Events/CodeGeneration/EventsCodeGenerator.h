@@ -376,6 +376,16 @@ class GD_CORE_API EventsCodeGenerator {
   virtual gd::String GetObjectListName(
       const gd::String& name, const gd::EventsCodeGenerationContext& context);
 
+  /**
+   * \brief Generate the code to get all the instances of an object, used to
+   * declare the list of the objects picked by an event.
+   *
+   * \note The generated code can return a reference to the list of the
+   * instances: the declared list is a copy of it, as picking objects removes
+   * them from the list.
+   */
+  virtual gd::String GenerateAllInstancesGetter(const gd::String& objectName);
+
   /**
    * \brief Generate the code to notify the profiler of the beginning of a
    * section.
@@ -89,6 +89,11 @@ void Direction::UnserializeFrom(const gd::SerializerElement& element) {
     Sprite sprite;
 
     sprite.SetImageName(spriteElement.GetStringAttribute("image"));
+    if (spriteElement.HasAttribute("imageRectWidth"))
+      sprite.SetImageRect(spriteElement.GetIntAttribute("imageRectX"),
+                          spriteElement.GetIntAttribute("imageRectY"),
+                          spriteElement.GetIntAttribute("imageRectWidth"),
+                          spriteElement.GetIntAttribute("imageRectHeight"));
     OpenPointsSprites(sprite.GetAllNonDefaultPoints(),
                       spriteElement.GetChild("points", 0, "Points"));
 
@@ -156,6 +161,14 @@ void SaveSpritesDirection(const vector<Sprite>& sprites,
     gd::SerializerElement& spriteElement = element.AddChild("sprite");
 
     spriteElement.SetAttribute("image", sprites[i].GetImageName());
+    if (sprites[i].HasImageRect()) {
+      spriteElement.SetAttribute("imageRectX", sprites[i].GetImageRectX());
+      spriteElement.SetAttribute("imageRectY", sprites[i].GetImageRectY());
+      spriteElement.SetAttribute("imageRectWidth",
+                                 sprites[i].GetImageRectWidth());
+      spriteElement.SetAttribute("imageRectHeight",
+                                 sprites[i].GetImageRectHeight());
+    }
     SavePointsSprites(sprites[i].GetAllNonDefaultPoints(),
                       spriteElement.AddChild("points"));
 
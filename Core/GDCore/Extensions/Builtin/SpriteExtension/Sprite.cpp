@@ -20,6 +20,10 @@ Sprite::Sprite()
 #if !defined(EMSCRIPTEN)
       hasItsOwnImage(false),
 #endif
+      imageRectX(0),
+      imageRectY(0),
+      imageRectWidth(0),
+      imageRectHeight(0),
       automaticCollisionMask(true),
       origine("origine"),
       centre("centre"),
@@ -115,6 +119,9 @@ void Sprite::SetCustomCollisionMask(
 void Sprite::LoadImage(std::shared_ptr<SFMLTextureWrapper> image_) {
   sfmlImage = image_;
   sfmlSprite.setTexture(sfmlImage->texture, true);
+  if (HasImageRect())
+    sfmlSprite.setTextureRect(sf::IntRect(
+        imageRectX, imageRectY, imageRectWidth, imageRectHeight));
   hasItsOwnImage = false;
 
   if (automaticCentre)
@@ -124,9 +131,17 @@ void Sprite::LoadImage(std::shared_ptr<SFMLTextureWrapper> image_) {
 
 void Sprite::MakeSpriteOwnsItsImage() {
   if (!hasItsOwnImage || sfmlImage == std::shared_ptr<SFMLTextureWrapper>()) {
-    sfmlImage = std::make_shared<SFMLTextureWrapper>(
-        sfmlImage->texture);  // Copy the texture.
-    sfmlSprite.setTexture(sfmlImage->texture);
+    // Copy only the part of the image displayed by the sprite, as the image
+    // can be a page of a texture atlas.
+    sf::IntRect rect = sfmlSprite.getTextureRect();
+    auto ownImage = std::make_shared<SFMLTextureWrapper>();
+    ownImage->image.create(rect.width, rect.height, sf::Color::Transparent);
+    ownImage->image.copy(sfmlImage->image, 0, 0, rect);
+    ownImage->texture.loadFromImage(ownImage->image);
+    ownImage->texture.setSmooth(sfmlImage->texture.isSmooth());
+
+    sfmlImage = ownImage;
+    sfmlSprite.setTexture(sfmlImage->texture, true);
     hasItsOwnImage = true;
   }
 }
@@ -46,6 +46,32 @@ class GD_CORE_API Sprite {
    */
   inline gd::String& GetImageName() { return image; }
 
+  /**
+   * \brief Change the part of the image displayed by the sprite (used when
+   * the image is a texture atlas containing the images of multiple sprites).
+   *
+   * A rectangle with a width or a height of 0 displays the whole image.
+   */
+  void SetImageRect(int x, int y, int width, int height) {
+    imageRectX = x;
+    imageRectY = y;
+    imageRectWidth = width;
+    imageRectHeight = height;
+  }
+
+  /**
+   * \brief Return true if only a part of the image is displayed.
+   * \see SetImageRect
+   */
+  bool HasImageRect() const {
+    return imageRectWidth > 0 && imageRectHeight > 0;
+  }
+
+  int GetImageRectX() const { return imageRectX; }
+  int GetImageRectY() const { return imageRectY; }
+  int GetImageRectWidth() const { return imageRectWidth; }
+  int GetImageRectHeight() const { return imageRectHeight; }
+
   /**
    * \brief Get the collision mask (custom or automatically generated owing to
    * IsCollisionMaskAutomatic())
@@ -198,6 +224,9 @@ class GD_CORE_API Sprite {
   /**
    * \brief Make the sprite, if it uses a texture from ImageManager,
    * copy this texture and take ownership of it.
+   *
+   * Only the part of the texture displayed by the sprite is copied: the
+   * sprite then displays the whole copied texture.
    */
   void MakeSpriteOwnsItsImage();
 ///@}
@@ -211,6 +240,10 @@ class GD_CORE_API Sprite {
   bool hasItsOwnImage;  ///< True if sfmlImage is only owned by this Sprite.
 #endif
   gd::String image;  ///< Name of the image to be loaded in Image Manager.
+  int imageRectX;       ///< The part of the image displayed by the sprite.
+  int imageRectY;       ///< \see SetImageRect
+  int imageRectWidth;   ///< 0 to display the whole image.
+  int imageRectHeight;  ///< 0 to display the whole image.
 
   bool automaticCollisionMask;  ///< True to use the custom collision mask.
                                 ///< Otherwise, a basic bounding box is returned
@@ -0,0 +1,224 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/SpritesAtlasPacker.h"
+#include <algorithm>
+#include <map>
+#include <set>
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/IDE/Project/ProjectResourcesAdder.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Tools/Log.h"
+#if !defined(EMSCRIPTEN)
+#include <SFML/Graphics/Image.hpp>
+#endif
+
+namespace gd {
+
+constexpr std::size_t SpritesAtlasPacker::NotPacked;
+
+std::vector<SpritesAtlasPacker::Placement> SpritesAtlasPacker::PackRectangles(
+    const std::vector<std::pair<unsigned int, unsigned int> >& sizes,
+    unsigned int pageSize,
+    unsigned int padding,
+    std::size_t& pagesCount) {
+  // Rectangles are put on shelves (rows of rectangles), from the tallest to
+  // the smallest, so that rectangles of a shelf have similar heights.
+  std::vector<std::size_t> order;
+  for (std::size_t i = 0; i < sizes.size(); ++i) order.push_back(i);
+  std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a,
+                                                        std::size_t b) {
+    return sizes[a].second > sizes[b].second;
+  });
+
+  struct Shelf {
+    std::size_t page;
+    unsigned int y;
+    unsigned int height;
+    unsigned int usedWidth;
+  };
+  std::vector<Shelf> shelves;
+  std::vector<unsigned int> pagesUsedHeight;
+
+  std::vector<Placement> placements(sizes.size());
+  for (std::size_t i : order) {
+    unsigned int width = sizes[i].first + padding;
+    unsigned int height = sizes[i].second + padding;
+    Placement& placement = placements[i];
+    placement.page = NotPacked;
+    placement.x = 0;
+    placement.y = 0;
+    if (sizes[i].first > pageSize || sizes[i].second > pageSize) continue;
+
+    auto shelf = std::find_if(
+        shelves.begin(), shelves.end(), [&](const Shelf& shelf) {
+          return height <= shelf.height &&
+                 shelf.usedWidth + sizes[i].first <= pageSize;
+        });
+    if (shelf == shelves.end()) {
+      // Open a new shelf, on a new page if needed.
+      std::size_t page = 0;
+      while (page < pagesUsedHeight.size() &&
+             pagesUsedHeight[page] + sizes[i].second > pageSize)
+        ++page;
+      if (page == pagesUsedHeight.size()) pagesUsedHeight.push_back(0);
+
+      shelves.push_back(Shelf{page, pagesUsedHeight[page], height, 0});
+      pagesUsedHeight[page] += height;
+      shelf = shelves.end() - 1;
+    }
+
+    placement.page = shelf->page;
+    placement.x = shelf->usedWidth;
+    placement.y = shelf->y;
+    shelf->usedWidth += width;
+  }
+
+  pagesCount = pagesUsedHeight.size();
+  return placements;
+}
+
+std::size_t SpritesAtlasPacker::PackProjectSprites(
+    gd::Project& project,
+    const gd::String& outputDirectory,
+    unsigned int pageSize) {
+#if defined(EMSCRIPTEN)
+  return 0;
+#else
+  // List the sprites of all the sprite objects, by image.
+  std::map<gd::String, std::vector<gd::Sprite*> > imagesSprites;
+  auto addObjectSprites = [&imagesSprites](gd::Object& object) {
+    gd::SpriteObject* spriteObject = dynamic_cast<gd::SpriteObject*>(&object);
+    if (!spriteObject) return;
+
+    for (std::size_t i = 0; i < spriteObject->GetAnimationsCount(); ++i) {
+      gd::Animation& animation = spriteObject->GetAnimation(i);
+      for (std::size_t j = 0; j < animation.GetDirectionsCount(); ++j) {
+        gd::Direction& direction = animation.GetDirection(j);
+        for (std::size_t k = 0; k < direction.GetSpritesCount(); ++k) {
+          gd::Sprite& sprite = direction.GetSprite(k);
+          if (!sprite.HasImageRect())
+            imagesSprites[sprite.GetImageName()].push_back(&sprite);
+        }
+      }
+    }
+  };
+  for (std::size_t i = 0; i < project.GetObjectsCount(); ++i)
+    addObjectSprites(project.GetObject(i));
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    gd::Layout& layout = project.GetLayout(i);
+    for (std::size_t j = 0; j < layout.GetObjectsCount(); ++j)
+      addObjectSprites(layout.GetObject(j));
+  }
+
+  // Load the images, separating the images that are smoothed from the others
+  // as the smoothing is set for a whole texture.
+  gd::ResourcesManager& resourcesManager = project.GetResourcesManager();
+  std::map<bool, std::vector<gd::String> > imagesBySmoothing;
+  std::map<gd::String, sf::Image> images;
+  for (auto& imageSprites : imagesSprites) {
+    const gd::String& imageName = imageSprites.first;
+    if (!resourcesManager.HasResource(imageName)) continue;
+
+    gd::ImageResource* resource = dynamic_cast<gd::ImageResource*>(
+        &resourcesManager.GetResource(imageName));
+    if (!resource) continue;
+
+    sf::Image& image = images[imageName];
+    if (!image.loadFromFile(
+            resource->GetAbsoluteFile(project).ToLocale().c_str())) {
+      gd::LogWarning("Unable to load " + imageName +
+                     " to pack it in a texture atlas.");
+      images.erase(imageName);
+      continue;
+    }
+
+    imagesBySmoothing[resource->IsSmooth()].push_back(imageName);
+  }
+
+  std::set<gd::String> packedImages;
+  std::size_t pagesCount = 0;
+  for (auto& smoothingImages : imagesBySmoothing) {
+    const std::vector<gd::String>& imageNames = smoothingImages.second;
+    std::vector<std::pair<unsigned int, unsigned int> > sizes;
+    for (const gd::String& imageName : imageNames)
+      sizes.push_back(std::make_pair(images[imageName].getSize().x,
+                                     images[imageName].getSize().y));
+
+    std::size_t pagesCountForSmoothing = 0;
+    std::vector<Placement> placements =
+        PackRectangles(sizes, pageSize, 2, pagesCountForSmoothing);
+
+    for (std::size_t page = 0; page < pagesCountForSmoothing; ++page) {
+      // Make the page as small as possible.
+      unsigned int width = 0, height = 0;
+      bool alwaysLoaded = false;
+      for (std::size_t i = 0; i < imageNames.size(); ++i) {
+        if (placements[i].page != page) continue;
+
+        width = std::max(width, placements[i].x + sizes[i].first);
+        height = std::max(height, placements[i].y + sizes[i].second);
+        alwaysLoaded |= dynamic_cast<gd::ImageResource&>(
+                            resourcesManager.GetResource(imageNames[i]))
+                            .alwaysLoaded;
+      }
+
+      sf::Image pageImage;
+      pageImage.create(width, height, sf::Color(0, 0, 0, 0));
+      for (std::size_t i = 0; i < imageNames.size(); ++i) {
+        if (placements[i].page != page) continue;
+        pageImage.copy(
+            images[imageNames[i]], placements[i].x, placements[i].y);
+      }
+
+      gd::String pageName;
+      do {
+        pageName = "GDTextureAtlas" + gd::String::From(pagesCount++);
+      } while (resourcesManager.HasResource(pageName));
+      gd::String pageFile = outputDirectory + "/" + pageName + ".png";
+      if (!pageImage.saveToFile(pageFile.ToLocale().c_str())) {
+        gd::LogError("Unable to save the texture atlas " + pageFile);
+        continue;
+      }
+
+      gd::ImageResource pageResource;
+      pageResource.SetName(pageName);
+      pageResource.SetFile(pageFile);
+      pageResource.SetSmooth(smoothingImages.first);
+      pageResource.alwaysLoaded = alwaysLoaded;
+      resourcesManager.AddResource(pageResource);
+
+      // Display the part of the page containing the image in the sprites.
+      for (std::size_t i = 0; i < imageNames.size(); ++i) {
+        if (placements[i].page != page) continue;
+
+        for (gd::Sprite* sprite : imagesSprites[imageNames[i]]) {
+          sprite->SetImageName(pageName);
+          sprite->SetImageRect(
+              placements[i].x, placements[i].y, sizes[i].first, sizes[i].second);
+        }
+        packedImages.insert(imageNames[i]);
+      }
+    }
+  }
+
+  // Remove the packed images, unless they are used by something else than
+  // sprites.
+  for (const gd::String& unusedImage :
+       gd::ProjectResourcesAdder::GetAllUseless(project, "image")) {
+    if (packedImages.find(unusedImage) != packedImages.end())
+      resourcesManager.RemoveResource(unusedImage);
+  }
+
+  return packedImages.size();
+#endif
+}
+
+}  // namespace gd
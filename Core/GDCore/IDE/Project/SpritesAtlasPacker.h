@@ -0,0 +1,73 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_SPRITESATLASPACKER_H
+#define GDCORE_SPRITESATLASPACKER_H
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "GDCore/String.h"
+namespace gd {
+class Project;
+}
+
+namespace gd {
+
+/**
+ * \brief Pack the images of the frames of sprite objects into a few images
+ * (the pages of a texture atlas), and update the sprites so that they display
+ * the part of the page containing their image.
+ *
+ * Used when exporting a game, so that the game loads less textures and can
+ * draw sprites sharing a page with a single draw call.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API SpritesAtlasPacker {
+ public:
+  /**
+   * \brief The position of a rectangle packed by PackRectangles.
+   */
+  struct Placement {
+    std::size_t page;  ///< The page containing the rectangle, or NotPacked.
+    unsigned int x;
+    unsigned int y;
+  };
+
+  static constexpr std::size_t NotPacked = static_cast<std::size_t>(-1);
+
+  /**
+   * \brief Pack rectangles into pages of at most \a pageSize x \a pageSize
+   * pixels, keeping at least \a padding pixels between them.
+   *
+   * \param sizes The width and height of each rectangle.
+   * \param pagesCount Set to the number of pages used.
+   * \return The placement of each rectangle. Rectangles bigger than a page are
+   * not packed.
+   */
+  static std::vector<Placement> PackRectangles(
+      const std::vector<std::pair<unsigned int, unsigned int> >& sizes,
+      unsigned int pageSize,
+      unsigned int padding,
+      std::size_t& pagesCount);
+
+  /**
+   * \brief Pack the images used by the sprite objects of the project into
+   * pages saved as PNG files in \a outputDirectory.
+   *
+   * The pages are added to the resources of the project, the sprites are
+   * updated to use them (see gd::Sprite::SetImageRect) and the images that are
+   * not used anymore are removed from the resources.
+   *
+   * \return The number of images packed in the pages.
+   */
+  static std::size_t PackProjectSprites(gd::Project& project,
+                                        const gd::String& outputDirectory,
+                                        unsigned int pageSize = 2048);
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_SPRITESATLASPACKER_H
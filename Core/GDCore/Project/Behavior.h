@@ -162,6 +162,19 @@ class GD_CORE_API Behavior {
    */
   inline bool Activated() const { return activated; };
 
+  /**
+   * Reimplement this method to return true if the steps of the behavior only
+   * change its own object (objects can still be created or deleted), so that
+   * the behaviors of this type can be run in parallel.
+   *
+   * \note The const methods of the objects (like GetWidth or GetDrawableX)
+   * used by such behaviors must not write any state shared with other
+   * objects, as they are called by several threads at once.
+   *
+   * \see BehaviorsScheduler::SetThreadsCount
+   */
+  virtual bool CanStepInParallel() const { return false; };
+
   /**
    * Reimplement this method to do extra work when the behavior is activated
    */
@@ -5,6 +5,7 @@
  */
 #include "GDCore/Project/ImageManager.h"
 #include <SFML/OpenGL.hpp>
+#include <mutex>
 #include "GDCore/Project/ResourcesLoader.h"
 #include "GDCore/Project/ResourcesManager.h"
 #include "GDCore/Tools/InvalidImage.h"
@@ -15,7 +16,19 @@
 
 namespace gd {
 
-ImageManager::ImageManager() : resourcesManager(NULL) {
+namespace {
+/**
+ * Protect the lists of loaded images, as scenes can be loaded by another
+ * thread while the game is running (see SceneStack::Preload). Recursive as
+ * some methods call each other.
+ */
+std::recursive_mutex loadedImagesMutex;
+}
+
+ImageManager::ImageManager()
+    : loadedTexturesSize(std::make_shared<std::atomic<std::size_t> >(0)),
+      texturesBudget(0),
+      resourcesManager(NULL) {
 #if !defined(EMSCRIPTEN)
   badTexture = std::make_shared<SFMLTextureWrapper>();
   badTexture->texture.loadFromMemory(gd::InvalidImageData,
@@ -32,9 +45,13 @@ std::shared_ptr<SFMLTextureWrapper> ImageManager::GetSFMLTexture(
     return badTexture;
   }
 
+  std::lock_guard<std::recursive_mutex> lock(loadedImagesMutex);
   if (alreadyLoadedImages.find(name) != alreadyLoadedImages.end() &&
-      !alreadyLoadedImages.find(name)->second.expired())
-    return alreadyLoadedImages.find(name)->second.lock();
+      !alreadyLoadedImages.find(name)->second.expired()) {
+    auto texture = alreadyLoadedImages.find(name)->second.lock();
+    UpdateRecentlyUsedTextures(texture);
+    return texture;
+  }
 
   std::cout << "ImageManager: Loading " << name << ".";
 
@@ -49,12 +66,14 @@ std::shared_ptr<SFMLTextureWrapper> ImageManager::GetSFMLTexture(
     texture->texture.setSmooth(image.smooth);
 
     alreadyLoadedImages[name] = texture;
+    CountLoadedTexture(*texture);
 #if defined(GD_IDE_ONLY)
     if (preventUnloading)
       unloadingPreventer.push_back(
           texture);  // If unload prevention is activated, add the image to the
                      // list dedicated to prevent images from being unloaded.
 #endif
+    UpdateRecentlyUsedTextures(texture);
 
     return texture;
   } catch (...) {
@@ -66,6 +85,7 @@ std::shared_ptr<SFMLTextureWrapper> ImageManager::GetSFMLTexture(
 }
 
 bool ImageManager::HasLoadedSFMLTexture(const gd::String& name) const {
+  std::lock_guard<std::recursive_mutex> lock(loadedImagesMutex);
   if (alreadyLoadedImages.find(name) != alreadyLoadedImages.end() &&
       !alreadyLoadedImages.find(name)->second.expired())
     return true;
@@ -76,14 +96,91 @@ bool ImageManager::HasLoadedSFMLTexture(const gd::String& name) const {
 void ImageManager::SetSFMLTextureAsPermanentlyLoaded(
     const gd::String& name,
     std::shared_ptr<SFMLTextureWrapper>& texture) const {
+  std::lock_guard<std::recursive_mutex> lock(loadedImagesMutex);
   if (alreadyLoadedImages.find(name) == alreadyLoadedImages.end() ||
-      alreadyLoadedImages.find(name)->second.expired())
+      alreadyLoadedImages.find(name)->second.expired()) {
     alreadyLoadedImages[name] = texture;
+    CountLoadedTexture(*texture);
+  }
 
   if (permanentlyLoadedImages.find(name) == permanentlyLoadedImages.end())
     permanentlyLoadedImages[name] = texture;
 }
 
+void ImageManager::SetSFMLTexture(
+    const gd::String& name,
+    std::shared_ptr<SFMLTextureWrapper>& texture) const {
+  std::lock_guard<std::recursive_mutex> lock(loadedImagesMutex);
+  if (HasLoadedSFMLTexture(name)) return;
+
+  alreadyLoadedImages[name] = texture;
+  CountLoadedTexture(*texture);
+#if defined(GD_IDE_ONLY)
+  if (preventUnloading) unloadingPreventer.push_back(texture);
+#endif
+  UpdateRecentlyUsedTextures(texture);
+}
+
+void ImageManager::SetTexturesBudget(std::size_t budget) {
+  std::lock_guard<std::recursive_mutex> lock(loadedImagesMutex);
+  texturesBudget = budget;
+  if (texturesBudget == 0) {
+    recentlyUsedTextures.clear();
+    recentlyUsedTexturesPositions.clear();
+  } else
+    UnloadLeastRecentlyUsedTextures();
+}
+
+std::size_t ImageManager::GetLoadedTexturesSize() const {
+  return *loadedTexturesSize;
+}
+
+std::size_t ImageManager::GetTextureSize(const SFMLTextureWrapper& texture) {
+  sf::Vector2u size = texture.texture.getSize();
+  return static_cast<std::size_t>(size.x) * size.y * 4;
+}
+
+void ImageManager::UpdateRecentlyUsedTextures(
+    const std::shared_ptr<SFMLTextureWrapper>& texture) const {
+  if (texturesBudget == 0) return;
+
+  auto it = recentlyUsedTexturesPositions.find(texture.get());
+  if (it != recentlyUsedTexturesPositions.end()) {
+    recentlyUsedTextures.splice(
+        recentlyUsedTextures.begin(), recentlyUsedTextures, it->second);
+  } else {
+    recentlyUsedTextures.push_front(texture);
+    recentlyUsedTexturesPositions[texture.get()] = recentlyUsedTextures.begin();
+  }
+
+  UnloadLeastRecentlyUsedTextures();
+}
+
+void ImageManager::UnloadLeastRecentlyUsedTextures() const {
+  // Textures referenced elsewhere than in the list are still used.
+  std::size_t size = GetLoadedTexturesSize();
+  for (auto it = recentlyUsedTextures.end();
+       size > texturesBudget && it != recentlyUsedTextures.begin();) {
+    --it;
+    if (it->use_count() > 1) continue;
+
+    size -= (*it)->countedSize;
+    recentlyUsedTexturesPositions.erase(it->get());
+    it = recentlyUsedTextures.erase(it);
+  }
+}
+
+void ImageManager::CountLoadedTexture(SFMLTextureWrapper& texture) const {
+  if (texture.loadedTexturesSize &&
+      texture.loadedTexturesSize != loadedTexturesSize)
+    return;  // Already counted by another ImageManager.
+
+  if (texture.loadedTexturesSize) *loadedTexturesSize -= texture.countedSize;
+  texture.loadedTexturesSize = loadedTexturesSize;
+  texture.countedSize = GetTextureSize(texture);
+  *loadedTexturesSize += texture.countedSize;
+}
+
 void ImageManager::ReloadImage(const gd::String& name) const {
   if (!resourcesManager) {
     std::cout << "ImageManager has no ResourcesManager associated with.";
@@ -92,6 +189,7 @@ void ImageManager::ReloadImage(const gd::String& name) const {
 
   // Verify if image is in memory. If not, it will be automatically reloaded
   // when necessary.
+  std::lock_guard<std::recursive_mutex> lock(loadedImagesMutex);
   if (alreadyLoadedImages.find(name) == alreadyLoadedImages.end() ||
       alreadyLoadedImages.find(name)->second.expired())
     return;
@@ -109,6 +207,7 @@ void ImageManager::ReloadImage(const gd::String& name) const {
     ResourcesLoader::Get()->LoadSFMLImage(image.GetFile(), oldTexture->image);
     oldTexture->texture.loadFromImage(oldTexture->image);
     oldTexture->texture.setSmooth(image.smooth);
+    CountLoadedTexture(*oldTexture);
 
     return;
   } catch (...) { /*The ressource is not an image*/
@@ -118,10 +217,12 @@ void ImageManager::ReloadImage(const gd::String& name) const {
   std::cout << "ImageManager: " << name << " is not available anymore."
             << std::endl;
   *oldTexture = *badTexture;
+  CountLoadedTexture(*oldTexture);
 }
 
 std::shared_ptr<OpenGLTextureWrapper> ImageManager::GetOpenGLTexture(
     const gd::String& name) const {
+  std::lock_guard<std::recursive_mutex> lock(loadedImagesMutex);
   if (alreadyLoadedOpenGLTextures.find(name) !=
           alreadyLoadedOpenGLTextures.end() &&
       !alreadyLoadedOpenGLTextures.find(name)->second.expired())
@@ -145,6 +246,7 @@ void ImageManager::LoadPermanentImages() {
   // old list so as not to unload images that could be still present.
   std::map<gd::String, std::shared_ptr<SFMLTextureWrapper> >
       newPermanentlyLoadedImages;
+  std::lock_guard<std::recursive_mutex> lock(loadedImagesMutex);
 
   std::vector<gd::String> resources = resourcesManager->GetAllResourceNames();
   for (std::size_t i = 0; i < resources.size(); i++) {
@@ -164,6 +266,7 @@ void ImageManager::LoadPermanentImages() {
 
 #if defined(GD_IDE_ONLY)
 void ImageManager::PreventImagesUnloading() {
+  std::lock_guard<std::recursive_mutex> lock(loadedImagesMutex);
   preventUnloading = true;
   for (auto it = alreadyLoadedImages.begin(); it != alreadyLoadedImages.end();
        ++it) {
@@ -174,6 +277,7 @@ void ImageManager::PreventImagesUnloading() {
 }
 
 void ImageManager::EnableImagesUnloading() {
+  std::lock_guard<std::recursive_mutex> lock(loadedImagesMutex);
   preventUnloading = false;
   unloadingPreventer
       .clear();  // Images which are not used anymore will thus be destroyed (As
@@ -184,11 +288,25 @@ void ImageManager::EnableImagesUnloading() {
 }  // namespace gd
 
 SFMLTextureWrapper::SFMLTextureWrapper(const sf::Texture& texture_)
-    : texture(texture_), image(texture.copyToImage()) {}
+    : texture(texture_), image(texture.copyToImage()), countedSize(0) {}
 
-SFMLTextureWrapper::SFMLTextureWrapper() {}
+SFMLTextureWrapper::SFMLTextureWrapper() : countedSize(0) {}
 
-SFMLTextureWrapper::~SFMLTextureWrapper() {}
+SFMLTextureWrapper::SFMLTextureWrapper(const SFMLTextureWrapper& other)
+    : texture(other.texture), image(other.image), countedSize(0) {}
+
+SFMLTextureWrapper& SFMLTextureWrapper::operator=(
+    const SFMLTextureWrapper& other) {
+  // The texture stays counted by its ImageManager, if any: the ImageManager
+  // updates its size.
+  texture = other.texture;
+  image = other.image;
+  return *this;
+}
+
+SFMLTextureWrapper::~SFMLTextureWrapper() {
+  if (loadedTexturesSize) *loadedTexturesSize -= countedSize;
+}
 
 OpenGLTextureWrapper::OpenGLTextureWrapper(
     std::shared_ptr<SFMLTextureWrapper> sfmlTexture_) {
@@ -10,8 +10,11 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/OpenGL.hpp>
 #include <SFML/System.hpp>
+#include <atomic>
 #include <iostream>
+#include <list>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include "GDCore/String.h"
 namespace gd {
@@ -30,7 +33,9 @@ namespace gd {
  * Image manager is used by objects to obtain their images from the image name.
  *
  * Images are loaded dynamically when necessary, and are unloaded if there is no
- * more shared_ptr pointing on an image.
+ * more shared_ptr pointing on an image. A budget can be set so that images
+ * not used anymore stay loaded, until the least recently used ones are
+ * unloaded to stay within the budget (see SetTexturesBudget).
  *
  * You should in particular be interested by gd::ImageManager::GetOpenGLTexture
  * and gd::ImageManager::GetSFMLTexture.
@@ -93,11 +98,55 @@ class GD_CORE_API ImageManager {
       const gd::String& name,
       std::shared_ptr<SFMLTextureWrapper>& texture) const;
 
+  /**
+   * \brief Add the SFMLTextureWrapper to loaded images ( so that it can be
+   * accessed thanks to ImageManager::GetSFMLTexture ) with the specified name,
+   * unless an image with this name is already loaded.
+   *
+   * \see ResourcesPreloader
+   */
+  void SetSFMLTexture(const gd::String& name,
+                      std::shared_ptr<SFMLTextureWrapper>& texture) const;
+
   /**
    * \brief Reload a single image from the game resources
    */
   void ReloadImage(const gd::String& name) const;
 
+  /**
+   * \brief Set the size, in bytes, of the textures that can be loaded before
+   * unloading the textures not used anymore (by objects or scenes).
+   *
+   * Textures not used anymore are kept loaded (so that they don't have to be
+   * loaded again if used again) until the size of the loaded textures exceeds
+   * the budget: the least recently used ones are then unloaded. Textures still
+   * used are never unloaded.
+   *
+   * \warning The budget only bounds the textures kept in cache: as used
+   * textures are never unloaded, GetLoadedTexturesSize can exceed it.
+   *
+   * \note The default budget is 0: textures are unloaded as soon as they are
+   * not used anymore.
+   */
+  void SetTexturesBudget(std::size_t budget);
+
+  /**
+   * \brief Return the size, in bytes, of the textures that can be loaded
+   * before unloading the textures not used anymore.
+   * \see SetTexturesBudget
+   */
+  std::size_t GetTexturesBudget() const { return texturesBudget; }
+
+  /**
+   * \brief Return the size, in bytes, of all the textures loaded in memory.
+   */
+  std::size_t GetLoadedTexturesSize() const;
+
+  /**
+   * \brief Return the size, in bytes, of a texture.
+   */
+  static std::size_t GetTextureSize(const SFMLTextureWrapper& texture);
+
 #if defined(GD_IDE_ONLY)
   /**
    * \brief When called, images won't be unloaded from memory until
@@ -113,6 +162,25 @@ class GD_CORE_API ImageManager {
 #endif
 
  private:
+  /**
+   * \brief Mark the texture as the most recently used one, and unload the
+   * least recently used textures not used anymore if the budget is exceeded.
+   */
+  void UpdateRecentlyUsedTextures(
+      const std::shared_ptr<SFMLTextureWrapper>& texture) const;
+
+  /**
+   * \brief Unload the least recently used textures not used anymore, until the
+   * size of the loaded textures is within the budget.
+   */
+  void UnloadLeastRecentlyUsedTextures() const;
+
+  /**
+   * \brief Count the texture in the size of the loaded textures, or update its
+   * size if it is already counted.
+   */
+  void CountLoadedTexture(SFMLTextureWrapper& texture) const;
+
   mutable std::map<gd::String, std::weak_ptr<SFMLTextureWrapper> >
       alreadyLoadedImages;  ///< Reference all images loaded in memory.
   mutable std::map<gd::String, std::shared_ptr<SFMLTextureWrapper> >
@@ -141,6 +209,20 @@ class GD_CORE_API ImageManager {
   mutable std::shared_ptr<SFMLTextureWrapper> badTexture;
   mutable std::shared_ptr<OpenGLTextureWrapper> badOpenGLTexture;
 
+  mutable std::list<std::shared_ptr<SFMLTextureWrapper> >
+      recentlyUsedTextures;  ///< The textures kept loaded when a budget is
+                             ///< set, the most recently used first.
+  mutable std::unordered_map<
+      const SFMLTextureWrapper*,
+      std::list<std::shared_ptr<SFMLTextureWrapper> >::iterator>
+      recentlyUsedTexturesPositions;  ///< The position of each texture in
+                                      ///< recentlyUsedTextures.
+  std::shared_ptr<std::atomic<std::size_t> >
+      loadedTexturesSize;  ///< The size of the textures referenced by the
+                           ///< manager, decreased by the textures when they
+                           ///< are destroyed.
+  std::size_t texturesBudget;  ///< \see SetTexturesBudget
+
   gd::ResourcesManager* resourcesManager;
 };
 
@@ -156,12 +238,23 @@ class GD_CORE_API SFMLTextureWrapper {
  public:
   SFMLTextureWrapper(const sf::Texture& texture);
   SFMLTextureWrapper();
+  SFMLTextureWrapper(const SFMLTextureWrapper& other);
+  SFMLTextureWrapper& operator=(const SFMLTextureWrapper& other);
   ~SFMLTextureWrapper();
 
   sf::Texture texture;
   sf::Image image;  ///< Associated sfml image, used for pixel perfect collision
                     ///< for example. If you update the image, call
                     ///< LoadFromImage on texture to update it also.
+
+ private:
+  friend class gd::ImageManager;
+
+  std::shared_ptr<std::atomic<std::size_t> >
+      loadedTexturesSize;  ///< The size of the textures of the ImageManager
+                           ///< referencing this texture, if any.
+  std::size_t countedSize;  ///< The size of the texture counted in
+                            ///< loadedTexturesSize.
 };
 
 /**
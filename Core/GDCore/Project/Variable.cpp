@@ -5,7 +5,9 @@
  */
 
 #include "GDCore/Project/Variable.h"
-#include <sstream>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
 #include "GDCore/TinyXml/tinyxml.h"
@@ -14,29 +16,29 @@ using namespace std;
 
 namespace gd {
 
-/**
- * Get value as a double
- */
-double Variable::GetValue() const {
-  if (!isNumber) {
-    stringstream ss;
-    ss << str;
-    ss >> value;
-    isNumber = true;
+VariableChildKey::VariableChildKey(const gd::String& name_) : name(name_) {
+  // Keys can be created by several threads (for example, when a scene is
+  // loaded in background).
+  static std::mutex idsMutex;
+  static std::unordered_map<gd::String, std::size_t> ids;
+  std::lock_guard<std::mutex> lock(idsMutex);
+  auto it = ids.find(name);
+  if (it != ids.end()) {
+    id = it->second;
+  } else {
+    id = ids.size() + 1;
+    ids[name] = id;
   }
-
-  return value;
 }
 
-const gd::String& Variable::GetString() const {
-  if (isNumber) {
-    stringstream s;
-    s << (value);
-    str = s.str();
-    isNumber = false;
-  }
+void Variable::UpdateValueFromString() const {
+  value = str.To<double>();
+  numberDirty = false;
+}
 
-  return str;
+void Variable::UpdateStringFromValue() const {
+  str = gd::String::From(value);
+  stringDirty = false;
 }
 
 bool Variable::HasChild(const gd::String& name) const {
@@ -73,9 +75,55 @@ const Variable& Variable::GetChild(const gd::String& name) const {
   return *children[name];
 }
 
+Variable& Variable::GetChild(const VariableChildKey& key) {
+  if (childrenIndexCount > 0) {
+    std::size_t mask = childrenIndex.size() - 1;
+    for (std::size_t i = key.GetId() & mask; childrenIndex[i].first != 0;
+         i = (i + 1) & mask) {
+      if (childrenIndex[i].first == key.GetId())
+        return *childrenIndex[i].second;
+    }
+  }
+
+  Variable& child = GetChild(key.GetName());
+  IndexChild(key.GetId(), &child);
+  return child;
+}
+
+const Variable& Variable::GetChild(const VariableChildKey& key) const {
+  // Children are mutable, like for GetChild(const gd::String&) const.
+  return const_cast<Variable*>(this)->GetChild(key);
+}
+
+void Variable::IndexChild(std::size_t keyId, Variable* child) const {
+  // Keep the table at most 3/4 full, with a power of two size.
+  if ((childrenIndexCount + 1) * 4 > childrenIndex.size() * 3) {
+    std::vector<std::pair<std::size_t, Variable*>> oldIndex(
+        std::max<std::size_t>(8, childrenIndex.size() * 2));
+    oldIndex.swap(childrenIndex);
+    childrenIndexCount = 0;
+    for (auto& entry : oldIndex) {
+      if (entry.first != 0) IndexChild(entry.first, entry.second);
+    }
+  }
+
+  std::size_t mask = childrenIndex.size() - 1;
+  std::size_t i = keyId & mask;
+  while (childrenIndex[i].first != 0) i = (i + 1) & mask;
+
+  childrenIndex[i] = std::make_pair(keyId, child);
+  childrenIndexCount++;
+}
+
+void Variable::ClearChildrenIndex() const {
+  childrenIndex.clear();
+  childrenIndexCount = 0;
+}
+
 void Variable::RemoveChild(const gd::String& name) {
   if (!isStructure) return;
   children.erase(name);
+  ClearChildrenIndex();
 }
 
 bool Variable::RenameChild(const gd::String& oldName,
@@ -84,6 +132,7 @@ bool Variable::RenameChild(const gd::String& oldName,
 
   children[newName] = children[oldName];
   children.erase(oldName);
+  ClearChildrenIndex();
 
   return true;
 }
@@ -91,6 +140,7 @@ bool Variable::RenameChild(const gd::String& oldName,
 void Variable::ClearChildren() {
   if (!isStructure) return;
   children.clear();
+  ClearChildrenIndex();
 }
 
 void Variable::SerializeTo(SerializerElement& element) const {
@@ -108,6 +158,7 @@ void Variable::SerializeTo(SerializerElement& element) const {
 }
 
 void Variable::UnserializeFrom(const SerializerElement& element) {
+  ClearChildrenIndex();
   isStructure = element.HasChild("children", "Children");
 
   if (isStructure) {
@@ -145,6 +196,7 @@ void Variable::SaveToXml(TiXmlElement* element) const {
 void Variable::LoadFromXml(const TiXmlElement* element) {
   if (!element) return;
 
+  ClearChildrenIndex();
   isStructure = element->FirstChildElement("Children") != NULL;
 
   if (isStructure) {
@@ -185,6 +237,7 @@ void Variable::RemoveRecursively(const gd::Variable& variableToRemove) {
   for (auto it = children.begin(); it != children.end();) {
     if (it->second.get() == &variableToRemove) {
       it = children.erase(it);
+      ClearChildrenIndex();
     } else {
       it->second->RemoveRecursively(variableToRemove);
       it++;
@@ -196,7 +249,10 @@ Variable::Variable(const Variable& other)
     : value(other.value),
       str(other.str),
       isNumber(other.isNumber),
-      isStructure(other.isStructure) {
+      isStructure(other.isStructure),
+      numberDirty(other.numberDirty),
+      stringDirty(other.stringDirty),
+      childrenIndexCount(0) {
   CopyChildren(other);
 }
 
@@ -206,6 +262,8 @@ Variable& Variable::operator=(const Variable& other) {
     str = other.str;
     isNumber = other.isNumber;
     isStructure = other.isStructure;
+    numberDirty = other.numberDirty;
+    stringDirty = other.stringDirty;
     CopyChildren(other);
   }
 
@@ -214,6 +272,7 @@ Variable& Variable::operator=(const Variable& other) {
 
 void Variable::CopyChildren(const gd::Variable& other) {
   children.clear();
+  ClearChildrenIndex();
   for (auto& it : other.children) {
     children[it.first] = std::make_shared<gd::Variable>(*it.second);
   }
@@ -8,6 +8,7 @@
 #define GDCORE_VARIABLE_H
 #include <map>
 #include <memory>
+#include <vector>
 #include "GDCore/String.h"
 namespace gd {
 class SerializerElement;
@@ -16,6 +17,37 @@ class TiXmlElement;
 
 namespace gd {
 
+/**
+ * \brief The interned name of a child of a variable structure.
+ *
+ * Each different name is given a unique identifier, so that variables can
+ * find their children from a key without comparing strings. Events generated
+ * code declares one static key for each child name used in events. Keys can
+ * be created by several threads at the same time.
+ *
+ * \see gd::Variable::GetChild
+ *
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API VariableChildKey {
+ public:
+  VariableChildKey(const gd::String& name_);
+
+  /**
+   * \brief Return the name of the child.
+   */
+  const gd::String& GetName() const { return name; }
+
+  /**
+   * \brief Return the identifier of the name (never 0).
+   */
+  std::size_t GetId() const { return id; }
+
+ private:
+  gd::String name;
+  std::size_t id;
+};
+
 /**
  * \brief Defines a variable which can be used by an object, a layout or a
  * project.
@@ -29,7 +61,13 @@ class GD_CORE_API Variable {
   /**
    * \brief Default constructor creating a variable with 0 as value.
    */
-  Variable() : value(0), isNumber(true), isStructure(false){};
+  Variable()
+      : value(0),
+        isNumber(true),
+        isStructure(false),
+        numberDirty(false),
+        stringDirty(true),
+        childrenIndexCount(0){};
   Variable(const Variable&);
   virtual ~Variable(){};
 
@@ -43,28 +81,46 @@ class GD_CORE_API Variable {
 
   /**
    * \brief Return the content of the variable, considered as a string.
+   *
+   * The number is converted to a string only if it was changed since the
+   * last conversion.
    */
-  const gd::String& GetString() const;
+  const gd::String& GetString() const {
+    if (stringDirty) UpdateStringFromValue();
+    isNumber = false;
+    return str;
+  }
 
   /**
    * \brief Change the content of the variable, considered as a string.
    */
   void SetString(const gd::String& newStr) {
     str = newStr;
+    stringDirty = false;
+    numberDirty = true;
     isNumber = false;
     isStructure = false;
   }
 
   /**
    * \brief Return the content of the variable, considered as a number.
+   *
+   * The string is converted to a number only if it was changed since the
+   * last conversion.
    */
-  double GetValue() const;
+  double GetValue() const {
+    if (numberDirty) UpdateValueFromString();
+    isNumber = true;
+    return value;
+  }
 
   /**
    * \brief Change the content of the variable, considered as a number.
    */
   void SetValue(double val) {
     value = val;
+    numberDirty = false;
+    stringDirty = true;
     isNumber = true;
     isStructure = false;
   }
@@ -87,7 +143,12 @@ class GD_CORE_API Variable {
   // Operators are overloaded to allow accessing to variable using a simple
   // string-like semantic.
   void operator=(const gd::String& val) { SetString(val); };
-  void operator+=(const gd::String& val) { SetString(GetString() + val); }
+  void operator+=(const gd::String& val) {
+    GetString();
+    str += val;
+    numberDirty = true;
+    isStructure = false;
+  }
 
   bool operator==(const gd::String& val) const { return GetString() == val; };
   bool operator!=(const gd::String& val) const { return GetString() != val; };
@@ -130,6 +191,22 @@ class GD_CORE_API Variable {
    */
   const Variable& GetChild(const gd::String& name) const;
 
+  /**
+   * \brief Return the child with the name of the specified key.
+   *
+   * Same as GetChild(key.GetName()), but children already accessed with
+   * the key are found without comparing strings.
+   */
+  Variable& GetChild(const VariableChildKey& key);
+
+  /**
+   * \brief Return the child with the name of the specified key.
+   *
+   * Same as GetChild(key.GetName()), but children already accessed with
+   * the key are found without comparing strings.
+   */
+  const Variable& GetChild(const VariableChildKey& key) const;
+
   /**
    * \brief Remove the child with the specified name.
    *
@@ -215,8 +292,35 @@ class GD_CORE_API Variable {
   mutable bool isStructure;  ///< False when the variable is a primitive ( i.e:
                              ///< Number or String ), true when it is a
                              ///< structure and has may have children.
+  mutable bool numberDirty;  ///< True if value must be updated from str.
+  mutable bool stringDirty;  ///< True if str must be updated from value.
   mutable std::map<gd::String, std::shared_ptr<Variable>>
       children;  ///< Children, when the variable is considered as a structure.
+  mutable std::vector<std::pair<std::size_t, Variable*>>
+      childrenIndex;  ///< Open addressing table from the identifiers of
+                      ///< VariableChildKey to the children accessed with them.
+  mutable std::size_t childrenIndexCount;  ///< The number of children in
+                                           ///< childrenIndex.
+
+  /**
+   * Convert the string to the number, and mark the number as up to date.
+   */
+  void UpdateValueFromString() const;
+
+  /**
+   * Convert the number to the string, and mark the string as up to date.
+   */
+  void UpdateStringFromValue() const;
+
+  /**
+   * Add a child to childrenIndex.
+   */
+  void IndexChild(std::size_t keyId, Variable* child) const;
+
+  /**
+   * Empty childrenIndex. Must be called when children are removed or renamed.
+   */
+  void ClearChildrenIndex() const;
 
   /**
    * Initialize children by copying them from another variable.  Used by
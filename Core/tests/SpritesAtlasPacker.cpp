@@ -0,0 +1,54 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the packing of sprites images in texture atlases.
+ */
+#include "GDCore/IDE/Project/SpritesAtlasPacker.h"
+#include "catch.hpp"
+
+namespace {
+bool AreOverlapping(const gd::SpritesAtlasPacker::Placement& a,
+                    const std::pair<unsigned int, unsigned int>& aSize,
+                    const gd::SpritesAtlasPacker::Placement& b,
+                    const std::pair<unsigned int, unsigned int>& bSize) {
+  return a.page == b.page && a.x < b.x + bSize.first &&
+         b.x < a.x + aSize.first && a.y < b.y + bSize.second &&
+         b.y < a.y + aSize.second;
+}
+}  // namespace
+
+TEST_CASE("SpritesAtlasPacker", "[common]") {
+  SECTION("PackRectangles") {
+    std::vector<std::pair<unsigned int, unsigned int> > sizes;
+    for (unsigned int i = 0; i < 50; ++i)
+      sizes.push_back(std::make_pair(16 + (i * 7) % 48, 16 + (i * 13) % 64));
+    sizes.push_back(std::make_pair(256, 256));
+    sizes.push_back(std::make_pair(300, 10));  // Too wide for a page.
+
+    std::size_t pagesCount = 0;
+    std::vector<gd::SpritesAtlasPacker::Placement> placements =
+        gd::SpritesAtlasPacker::PackRectangles(sizes, 256, 2, pagesCount);
+    REQUIRE(placements.size() == sizes.size());
+    REQUIRE(pagesCount >= 2);
+    REQUIRE(pagesCount <= 3);
+    REQUIRE(placements.back().page == gd::SpritesAtlasPacker::NotPacked);
+
+    for (std::size_t i = 0; i + 1 < placements.size(); ++i) {
+      REQUIRE(placements[i].page < pagesCount);
+      REQUIRE((placements[i].x + sizes[i].first) <= 256);
+      REQUIRE((placements[i].y + sizes[i].second) <= 256);
+      for (std::size_t j = i + 1; j + 1 < placements.size(); ++j)
+        REQUIRE(AreOverlapping(
+                    placements[i], sizes[i], placements[j], sizes[j]) == false);
+    }
+  }
+  SECTION("PackRectangles with no rectangles") {
+    std::size_t pagesCount = 1;
+    REQUIRE(gd::SpritesAtlasPacker::PackRectangles({}, 256, 2, pagesCount)
+                .empty());
+    REQUIRE(pagesCount == 0);
+  }
+}
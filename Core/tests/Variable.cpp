@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <initializer_list>
 #include <map>
+#include <thread>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/VariablesContainer.h"
@@ -87,4 +88,63 @@ TEST_CASE("Variable", "[common][variables]") {
             "Hello second copied World");
     REQUIRE(variable3.GetChild("Child2").GetValue() == 44);
   }
+  SECTION("Children accessed with keys") {
+    gd::VariableChildKey key1("Child1");
+    gd::VariableChildKey key2("Child2");
+    REQUIRE(gd::VariableChildKey("Child1").GetId() == key1.GetId());
+    REQUIRE(key1.GetId() != key2.GetId());
+
+    gd::Variable variable;
+    variable.GetChild("Child1").SetValue(42);
+    REQUIRE(variable.GetChild(key1).GetValue() == 42);
+    REQUIRE(&variable.GetChild(key1) == &variable.GetChild("Child1"));
+    REQUIRE(&variable.GetChild(key2) == &variable.GetChild("Child2"));
+    REQUIRE(variable.GetChildrenCount() == 2);
+
+    // Many children can be accessed with keys.
+    std::vector<gd::VariableChildKey> keys;
+    for (std::size_t i = 0; i < 50; ++i)
+      keys.push_back(gd::VariableChildKey("Child" + gd::String::From(i)));
+    for (std::size_t i = 0; i < keys.size(); ++i)
+      variable.GetChild(keys[i]).SetValue(i);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      REQUIRE(variable.GetChild(keys[i]).GetValue() == i);
+      REQUIRE(&variable.GetChild(keys[i]) ==
+              &variable.GetChild("Child" + gd::String::From(i)));
+    }
+
+    // Keys give the new children after they are removed or renamed.
+    variable.RemoveChild("Child1");
+    REQUIRE(variable.GetChild(key1).GetValue() == 0);
+    variable.RenameChild("Child2", "Renamed");
+    REQUIRE(variable.GetChild(key2).GetValue() == 0);
+    REQUIRE(variable.GetChild("Renamed").GetValue() == 2);
+
+    gd::Variable copy;
+    copy = variable;
+    REQUIRE(&copy.GetChild(keys[3]) != &variable.GetChild(keys[3]));
+    REQUIRE(copy.GetChild(keys[3]).GetValue() == 3);
+
+    variable.ClearChildren();
+    REQUIRE(variable.GetChild(keys[3]).GetValue() == 0);
+    REQUIRE(variable.GetChildrenCount() == 1);
+  }
+  SECTION("Keys created by several threads") {
+    std::vector<std::vector<std::size_t> > ids(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < ids.size(); ++t) {
+      threads.push_back(std::thread([&ids, t]() {
+        for (std::size_t i = 0; i < 200; ++i)
+          ids[t].push_back(
+              gd::VariableChildKey("ThreadChild" + gd::String::From(i))
+                  .GetId());
+      }));
+    }
+    for (auto& thread : threads) thread.join();
+
+    // The same names are given the same identifiers by all threads.
+    for (std::size_t t = 1; t < ids.size(); ++t) REQUIRE(ids[t] == ids[0]);
+    std::sort(ids[0].begin(), ids[0].end());
+    REQUIRE(std::unique(ids[0].begin(), ids[0].end()) == ids[0].end());
+  }
 }
@@ -27,6 +27,7 @@ class GD_EXTENSION_API DestroyOutsideBehavior : public Behavior {
   DestroyOutsideBehavior();
   virtual ~DestroyOutsideBehavior(){};
   virtual Behavior* Clone() const { return new DestroyOutsideBehavior(*this); }
+  virtual bool CanStepInParallel() const { return true; }
 
 #if defined(GD_IDE_ONLY)
   /**
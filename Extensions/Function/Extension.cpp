@@ -18,6 +18,7 @@ This project is released under the MIT License.
 #if defined(GD_IDE_ONLY)
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/Events/Parsers/ExpressionParser.h"
+#include "GDCpp/Events/CodeGeneration/EventsCodeGenerator.h"
 #endif
 #include "FunctionEvent.h"
 
@@ -82,8 +83,8 @@ class Extension : public ExtensionBase {
           codeGenerator.AddGlobalDeclaration(
               "void " +
               FunctionEvent::MangleFunctionName(layout, *functionEvent) +
-              "(RuntimeContext *, std::map <gd::String, "
-              "std::vector<RuntimeObject*> *>, std::vector<gd::String> &);\n");
+              "(RuntimeContext *, RuntimeObjectsLists, "
+              "std::vector<gd::String> &);\n");
           gd::String code;
 
           // Generate code for objects passed as arguments
@@ -96,9 +97,10 @@ class Extension : public ExtensionBase {
             for (std::size_t i = 0; i < realObjects.size(); ++i) {
               context.EmptyObjectsListNeeded(realObjects[i]);
               objectsAsArgumentCode +=
-                  ".AddObjectListToMap(\"" +
-                  codeGenerator.ConvertToString(realObjects[i]) + "\", " +
-                  ManObjListName(realObjects[i]) + ")";
+                  ".AddObjectListToMap(" +
+                  ::EventsCodeGenerator::DeclareObjectSlot(codeGenerator,
+                                                           realObjects[i]) +
+                  ", " + ManObjListName(realObjects[i]) + ")";
             }
             objectsAsArgumentCode += ".ReturnObjectListsMap()";
           }
@@ -141,16 +143,15 @@ class Extension : public ExtensionBase {
               // Declaring function prototype.
               codeGenerator.AddGlobalDeclaration(
                   "void " + FunctionEvent::MangleFunctionName(layout, event) +
-                  "(RuntimeContext *, std::map <gd::String, "
-                  "std::vector<RuntimeObject*> *>, std::vector<gd::String> "
-                  "&);\n");
+                  "(RuntimeContext *, RuntimeObjectsLists, "
+                  "std::vector<gd::String> &);\n");
 
               // Generating function code:
               gd::String functionCode;
               functionCode +=
                   "\nvoid " + FunctionEvent::MangleFunctionName(layout, event) +
-                  "(RuntimeContext * runtimeContext, std::map <gd::String, "
-                  "std::vector<RuntimeObject*> *> objectsListsMap, "
+                  "(RuntimeContext * runtimeContext, RuntimeObjectsLists "
+                  "objectsListsMap, "
                   "std::vector<gd::String> & currentFunctionParameters)\n{\n";
 
               gd::EventsCodeGenerationContext callerContext;
@@ -163,9 +164,14 @@ class Extension : public ExtensionBase {
                   functionCode += "std::vector<RuntimeObject*> " +
                                   ManObjListName(realObjects[i]) + ";\n";
                   functionCode +=
-                      "if ( objectsListsMap[\"" + realObjects[i] +
-                      "\"] != NULL ) " + ManObjListName(realObjects[i]) +
-                      " = *objectsListsMap[\"" + realObjects[i] + "\"];\n";
+                      "if ( objectsListsMap.Get(" +
+                      ::EventsCodeGenerator::DeclareObjectSlot(codeGenerator,
+                                                               realObjects[i]) +
+                      ".name) != NULL ) " + ManObjListName(realObjects[i]) +
+                      " = *objectsListsMap.Get(" +
+                      ::EventsCodeGenerator::DeclareObjectSlot(codeGenerator,
+                                                               realObjects[i]) +
+                      ".name);\n";
                 }
               }
               functionCode += "{";
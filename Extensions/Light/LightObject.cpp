@@ -32,6 +32,7 @@ using namespace std;
 
 std::map<const gd::Layout*, std::weak_ptr<Light_Manager> >
     RuntimeLightObject::lightManagersList;
+std::mutex RuntimeLightObject::lightManagersListMutex;
 #if defined(GD_IDE_ONLY)
 sf::Texture LightObject::edittimeIconImage;
 sf::Sprite LightObject::edittimeIcon;
@@ -101,11 +102,14 @@ RuntimeLightObject::RuntimeLightObject(RuntimeScene& scene,
                 lightObject.GetColor());
 
   // Get a manager for the scene
-  if (lightManagersList[&scene].expired()) {
-    manager = std::make_shared<Light_Manager>();
-    lightManagersList[&scene] = manager;
-  } else
-    manager = lightManagersList[&scene].lock();
+  {
+    std::lock_guard<std::mutex> lock(lightManagersListMutex);
+    if (lightManagersList[&scene].expired()) {
+      manager = std::make_shared<Light_Manager>();
+      lightManagersList[&scene] = manager;
+    } else
+      manager = lightManagersList[&scene].lock();
+  }
 
   // Load ( only once for each scene ) the common blur effect, shared by all
   // lights.
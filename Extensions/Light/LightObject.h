@@ -14,6 +14,7 @@ This project is released under the MIT License.
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/System/Clock.hpp>
 #include <memory>
+#include <mutex>
 #include "Light.h"
 namespace sf {
 class Sprite;
@@ -173,6 +174,9 @@ class GD_EXTENSION_API RuntimeLightObject : public RuntimeObject {
 
   static std::map<const gd::Layout*, std::weak_ptr<Light_Manager> >
       lightManagersList;
+  static std::mutex lightManagersListMutex;  ///< Protect lightManagersList, as
+                                             ///< scenes can be loaded by
+                                             ///< another thread.
 
  private:
   void UpdateGlobalLightMembers();
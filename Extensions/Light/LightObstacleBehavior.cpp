@@ -54,11 +54,15 @@ sf::Vector2f LightObstacleBehavior::RotatePoint(const sf::Vector2f& Point,
  */
 void LightObstacleBehavior::DoStepPostEvents(RuntimeScene& scene) {
   // Get a manager for the scene
-  if (RuntimeLightObject::lightManagersList[&scene].expired()) {
-    manager = std::make_shared<Light_Manager>();
-    RuntimeLightObject::lightManagersList[&scene] = manager;
-  } else
-    manager = RuntimeLightObject::lightManagersList[&scene].lock();
+  {
+    std::lock_guard<std::mutex> lock(
+        RuntimeLightObject::lightManagersListMutex);
+    if (RuntimeLightObject::lightManagersList[&scene].expired()) {
+      manager = std::make_shared<Light_Manager>();
+      RuntimeLightObject::lightManagersList[&scene] = manager;
+    } else
+      manager = RuntimeLightObject::lightManagersList[&scene].lock();
+  }
 
   if (disabled ||
       (objectOldX == object->GetX() && objectOldY == object->GetY() &&
@@ -132,7 +132,7 @@ class LinkedObjectsCppExtension : public ExtensionBase {
    */
   virtual void ObjectDeletedFromScene(RuntimeScene& scene,
                                       RuntimeObject* object) {
-    GDpriv::LinkedObjects::ObjectsLinksManager::managers[&scene]
+    GDpriv::LinkedObjects::ObjectsLinksManager::Get(scene)
         .RemoveAllLinksOf(object);
   }
 
@@ -140,14 +140,14 @@ class LinkedObjectsCppExtension : public ExtensionBase {
    * Initialize manager of linked objects of scene
    */
   virtual void SceneLoaded(RuntimeScene& scene) {
-    GDpriv::LinkedObjects::ObjectsLinksManager::managers[&scene].ClearAll();
+    GDpriv::LinkedObjects::ObjectsLinksManager::Get(scene).ClearAll();
   }
 
   /**
    * Destroy manager of linked objects of scene
    */
   virtual void SceneUnloaded(RuntimeScene& scene) {
-    GDpriv::LinkedObjects::ObjectsLinksManager::managers.erase(&scene);
+    GDpriv::LinkedObjects::ObjectsLinksManager::Remove(scene);
   }
 };
 
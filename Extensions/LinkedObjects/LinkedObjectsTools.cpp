@@ -21,15 +21,26 @@ namespace GDpriv {
 namespace LinkedObjects {
 
 std::map<RuntimeScene*, ObjectsLinksManager> ObjectsLinksManager::managers;
+std::mutex ObjectsLinksManager::managersMutex;
+
+ObjectsLinksManager& ObjectsLinksManager::Get(RuntimeScene& scene) {
+  std::lock_guard<std::mutex> lock(managersMutex);
+  return managers[&scene];
+}
+
+void ObjectsLinksManager::Remove(RuntimeScene& scene) {
+  std::lock_guard<std::mutex> lock(managersMutex);
+  managers.erase(&scene);
+}
 
 bool GD_EXTENSION_API PickObjectsLinkedTo(
     RuntimeScene& scene,
-    std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectsLists,
+    RuntimeObjectsLists pickedObjectsLists,
     RuntimeObject* object) {
   if (!object) return false;
 
   std::vector<RuntimeObject*> linkedObjects =
-      ObjectsLinksManager::managers[&scene].GetObjectsLinkedWith(object);
+      ObjectsLinksManager::Get(scene).GetObjectsLinkedWith(object);
   return PickObjectsIf(
       pickedObjectsLists, false, [&linkedObjects](RuntimeObject* obj) {
         return std::find(linkedObjects.begin(), linkedObjects.end(), obj) !=
@@ -41,20 +52,20 @@ void GD_EXTENSION_API LinkObjects(RuntimeScene& scene,
                                   RuntimeObject* a,
                                   RuntimeObject* b) {
   if (!a || !b) return;
-  ObjectsLinksManager::managers[&scene].LinkObjects(a, b);
+  ObjectsLinksManager::Get(scene).LinkObjects(a, b);
 }
 
 void GD_EXTENSION_API RemoveLinkBetween(RuntimeScene& scene,
                                         RuntimeObject* a,
                                         RuntimeObject* b) {
   if (!a || !b) return;
-  ObjectsLinksManager::managers[&scene].RemoveLinkBetween(a, b);
+  ObjectsLinksManager::Get(scene).RemoveLinkBetween(a, b);
 }
 
 void GD_EXTENSION_API RemoveAllLinksOf(RuntimeScene& scene,
                                        RuntimeObject* object) {
   if (!object) return;
-  ObjectsLinksManager::managers[&scene].RemoveAllLinksOf(object);
+  ObjectsLinksManager::Get(scene).RemoveAllLinksOf(object);
 }
 
 }  // namespace LinkedObjects
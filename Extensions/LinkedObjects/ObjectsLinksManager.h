@@ -8,6 +8,7 @@ This project is released under the MIT License.
 #ifndef OBJECTSLINKSMANAGER_H
 #define OBJECTSLINKSMANAGER_H
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -50,11 +51,26 @@ class GD_EXTENSION_API ObjectsLinksManager {
    */
   void ClearAll();
 
-  static std::map<RuntimeScene*, ObjectsLinksManager>
-      managers;  // List of managers associated with scenes.
+  /**
+   * \brief Return the manager associated with the scene, creating it if
+   * needed.
+   *
+   * \note The managers can be accessed by different threads, as scenes can
+   * be loaded by another thread (see SceneStack::Preload).
+   */
+  static ObjectsLinksManager& Get(RuntimeScene& scene);
+
+  /**
+   * \brief Destroy the manager associated with the scene.
+   */
+  static void Remove(RuntimeScene& scene);
 
  private:
   std::map<RuntimeObject*, std::set<RuntimeObject*> > links;
+
+  static std::map<RuntimeScene*, ObjectsLinksManager>
+      managers;  // List of managers associated with scenes.
+  static std::mutex managersMutex;
 };
 
 }  // namespace LinkedObjects
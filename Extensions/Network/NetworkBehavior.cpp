@@ -124,11 +124,10 @@ void NetworkBehavior::DoStepPostEvents(RuntimeScene& scene) {
  * Generate an object network identifier, unique for each object.
  */
 void NetworkBehavior::GenerateObjectNetworkIdentifier(
-    std::map<gd::String, std::vector<RuntimeObject*>*> objectsLists1,
+    RuntimeObjectsLists objectsLists1,
     const gd::String& behaviorName) {
   std::vector<RuntimeObject*> objects1;
-  for (std::map<gd::String, std::vector<RuntimeObject*>*>::const_iterator it =
-           objectsLists1.begin();
+  for (RuntimeObjectsLists::const_iterator it = objectsLists1.begin();
        it != objectsLists1.end();
        ++it) {
     if (it->second != NULL) {
@@ -11,6 +11,7 @@ This project is released under the MIT License.
 #include <map>
 #include "GDCpp/Runtime/Project/Behavior.h"
 #include "GDCpp/Runtime/Project/Object.h"
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 #include "SceneNetworkDatas.h"
 namespace gd {
 class SerializerElement;
@@ -70,7 +71,7 @@ class GD_EXTENSION_API NetworkBehavior : public Behavior {
    * behaviorName.
    */
   static void GenerateObjectNetworkIdentifier(
-      std::map<gd::String, std::vector<RuntimeObject*>*> objectsLists,
+      RuntimeObjectsLists objectsLists,
       const gd::String& behaviorName);
 
  private:
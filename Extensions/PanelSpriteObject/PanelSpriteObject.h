@@ -132,6 +132,7 @@ class GD_EXTENSION_API RuntimePanelSpriteObject : public RuntimeObject {
 
   virtual float GetWidth() const { return width; };
   virtual float GetHeight() const { return height; };
+  virtual bool IsDrawnInsideAABB() const { return true; }
 
   virtual inline void SetWidth(float newWidth) {
     width = newWidth >= (leftMargin + rightMargin) ? newWidth
@@ -37,6 +37,7 @@ class GD_EXTENSION_API PathBehavior : public Behavior {
   virtual ~PathBehavior();
 
   virtual Behavior *Clone() const { return new PathBehavior(*this); }
+  virtual bool CanStepInParallel() const { return true; }
 
 #if defined(GD_IDE_ONLY)
   /**
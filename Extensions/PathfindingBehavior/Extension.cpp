@@ -9,6 +9,7 @@ This project is released under the MIT License.
 #include "GDCpp/Runtime/Project/BehaviorsSharedData.h"
 #include "PathfindingBehavior.h"
 #include "PathfindingObstacleBehavior.h"
+#include "ScenePathfindingObstaclesManager.h"
 
 void DeclarePathfindingBehaviorExtension(gd::PlatformExtension& extension) {
   extension.SetExtensionInformation(
@@ -700,6 +701,13 @@ class PathfindingBehaviorCppExtension : public ExtensionBase {
 
     GD_COMPLETE_EXTENSION_COMPILATION_INFORMATION();
   };
+
+  /**
+   * \brief Destroy obstacles list of the scene
+   */
+  virtual void SceneUnloaded(RuntimeScene& scene) {
+    ScenePathfindingObstaclesManager::Remove(scene);
+  }
 };
 
 #if defined(ANDROID)
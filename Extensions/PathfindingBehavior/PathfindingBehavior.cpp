@@ -423,7 +423,7 @@ void PathfindingBehavior::MoveTo(RuntimeScene& scene, float x, float y) {
   {
     parentScene = &scene;
     sceneManager = parentScene
-                       ? &ScenePathfindingObstaclesManager::managers[&scene]
+                       ? &ScenePathfindingObstaclesManager::Get(scene)
                        : NULL;
   }
 
@@ -494,7 +494,7 @@ void PathfindingBehavior::DoStepPreEvents(RuntimeScene& scene) {
   {
     parentScene = &scene;
     sceneManager = parentScene
-                       ? &ScenePathfindingObstaclesManager::managers[&scene]
+                       ? &ScenePathfindingObstaclesManager::Get(scene)
                        : NULL;
   }
 
@@ -540,7 +540,7 @@ void PathfindingBehavior::DoStepPostEvents(RuntimeScene& scene) {
   {
     parentScene = &scene;
     sceneManager = parentScene
-                       ? &ScenePathfindingObstaclesManager::managers[&scene]
+                       ? &ScenePathfindingObstaclesManager::Get(scene)
                        : NULL;
   }
 }
@@ -38,7 +38,7 @@ void PathfindingObstacleBehavior::DoStepPreEvents(RuntimeScene& scene) {
 
     parentScene = &scene;
     sceneManager = parentScene
-                       ? &ScenePathfindingObstaclesManager::managers[&scene]
+                       ? &ScenePathfindingObstaclesManager::Get(scene)
                        : NULL;
     registeredInManager = false;
   }
@@ -10,6 +10,17 @@ This project is released under the MIT License.
 
 std::map<RuntimeScene*, ScenePathfindingObstaclesManager>
     ScenePathfindingObstaclesManager::managers;
+std::recursive_mutex ScenePathfindingObstaclesManager::managersMutex;
+
+ScenePathfindingObstaclesManager& ScenePathfindingObstaclesManager::Get(RuntimeScene& scene) {
+  std::lock_guard<std::recursive_mutex> lock(managersMutex);
+  return managers[&scene];
+}
+
+void ScenePathfindingObstaclesManager::Remove(RuntimeScene& scene) {
+  std::lock_guard<std::recursive_mutex> lock(managersMutex);
+  managers.erase(&scene);
+}
 
 ScenePathfindingObstaclesManager::~ScenePathfindingObstaclesManager() {
   for (std::set<PathfindingObstacleBehavior*>::iterator it =
@@ -7,6 +7,7 @@ This project is released under the MIT License.
 #ifndef SCENEPLATFORMOBJECTSMANAGER_H
 #define SCENEPLATFORMOBJECTSMANAGER_H
 #include <map>
+#include <mutex>
 #include <set>
 #include "GDCpp/Runtime/RuntimeScene.h"
 class PathfindingObstacleBehavior;
@@ -17,10 +18,18 @@ class PathfindingObstacleBehavior;
 class ScenePathfindingObstaclesManager {
  public:
   /**
-   * \brief Map containing, for each RuntimeScene, its associated
-   * ScenePathfindingObstaclesManager.
+   * \brief Return the manager associated with the scene, creating it if
+   * needed.
+   *
+   * \note The managers can be accessed by different threads, as scenes can
+   * be loaded by another thread (see SceneStack::Preload).
    */
-  static std::map<RuntimeScene*, ScenePathfindingObstaclesManager> managers;
+  static ScenePathfindingObstaclesManager& Get(RuntimeScene& scene);
+
+  /**
+   * \brief Destroy the manager associated with the scene.
+   */
+  static void Remove(RuntimeScene& scene);
 
   ScenePathfindingObstaclesManager(){};
   virtual ~ScenePathfindingObstaclesManager();
@@ -47,6 +56,9 @@ class ScenePathfindingObstaclesManager {
  private:
   std::set<PathfindingObstacleBehavior*>
       allObstacles;  ///< The list of all obstacles of the scene.
+  static std::map<RuntimeScene*, ScenePathfindingObstaclesManager>
+      managers;  ///< The manager associated with each RuntimeScene.
+  static std::recursive_mutex managersMutex;  ///< Protect managers.
 };
 
 #endif
@@ -596,14 +596,13 @@ double PhysicsBehavior::GetAngularDamping(const RuntimeScene &scene) {
  * Test if there is a contact with another object
  */
 bool PhysicsBehavior::CollisionWith(
-    std::map<gd::String, std::vector<RuntimeObject *> *> otherObjectsLists,
+    RuntimeObjectsLists otherObjectsLists,
     RuntimeScene &scene) {
   if (!body) CreateBody(scene);
 
   // Getting a list of all objects which are tested
   std::vector<RuntimeObject *> objects;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
-           otherObjectsLists.begin();
+  for (RuntimeObjectsLists::const_iterator it = otherObjectsLists.begin();
        it != otherObjectsLists.end();
        ++it) {
     if (it->second != NULL) {
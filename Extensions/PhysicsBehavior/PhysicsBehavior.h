@@ -13,6 +13,7 @@ This project is released under the MIT License.
 #include <vector>
 #include "GDCpp/Runtime/Project/Behavior.h"
 #include "GDCpp/Runtime/Project/Object.h"
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 #include "SFML/Config.hpp"
 #include "SFML/System/Vector2.hpp"
 namespace gd {
@@ -176,7 +177,7 @@ class GD_EXTENSION_API PhysicsBehavior : public Behavior {
       char32_t composantSep = U';');
 
   bool CollisionWith(
-      std::map<gd::String, std::vector<RuntimeObject *> *> otherObjectsLists,
+      RuntimeObjectsLists otherObjectsLists,
       RuntimeScene &scene);
 
  private:
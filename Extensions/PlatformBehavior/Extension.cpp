@@ -577,14 +577,14 @@ class PlatformBehaviorCppExtension : public ExtensionBase {
    */
   virtual void SceneLoaded(RuntimeScene& scene) {
     ScenePlatformObjectsManager emptyManager;
-    ScenePlatformObjectsManager::managers[&scene] = emptyManager;
+    ScenePlatformObjectsManager::Get(scene) = emptyManager;
   }
 
   /**
    * \brief Destroy platforms list of the scene
    */
   virtual void SceneUnloaded(RuntimeScene& scene) {
-    ScenePlatformObjectsManager::managers.erase(&scene);
+    ScenePlatformObjectsManager::Remove(scene);
   }
 };
 
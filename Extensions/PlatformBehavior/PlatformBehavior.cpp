@@ -40,7 +40,7 @@ void PlatformBehavior::DoStepPreEvents(RuntimeScene& scene) {
 
     parentScene = &scene;
     sceneManager =
-        parentScene ? &ScenePlatformObjectsManager::managers[&scene] : NULL;
+        parentScene ? &ScenePlatformObjectsManager::Get(scene) : NULL;
     registeredInManager = false;
   }
 
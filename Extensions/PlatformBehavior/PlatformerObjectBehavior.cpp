@@ -87,7 +87,7 @@ void PlatformerObjectBehavior::DoStepPreEvents(RuntimeScene& scene) {
   {
     parentScene = &scene;
     sceneManager =
-        parentScene ? &ScenePlatformObjectsManager::managers[&scene] : NULL;
+        parentScene ? &ScenePlatformObjectsManager::Get(scene) : NULL;
     floorPlatform = NULL;
   }
 
@@ -627,7 +627,7 @@ void PlatformerObjectBehavior::DoStepPostEvents(RuntimeScene& scene) {
   {
     parentScene = &scene;
     sceneManager =
-        parentScene ? &ScenePlatformObjectsManager::managers[&scene] : NULL;
+        parentScene ? &ScenePlatformObjectsManager::Get(scene) : NULL;
     floorPlatform = NULL;
   }
 }
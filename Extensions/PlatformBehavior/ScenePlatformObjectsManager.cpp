@@ -3,6 +3,17 @@
 
 std::map<RuntimeScene*, ScenePlatformObjectsManager>
     ScenePlatformObjectsManager::managers;
+std::recursive_mutex ScenePlatformObjectsManager::managersMutex;
+
+ScenePlatformObjectsManager& ScenePlatformObjectsManager::Get(RuntimeScene& scene) {
+  std::lock_guard<std::recursive_mutex> lock(managersMutex);
+  return managers[&scene];
+}
+
+void ScenePlatformObjectsManager::Remove(RuntimeScene& scene) {
+  std::lock_guard<std::recursive_mutex> lock(managersMutex);
+  managers.erase(&scene);
+}
 
 ScenePlatformObjectsManager::~ScenePlatformObjectsManager() {
   for (std::set<PlatformBehavior*>::iterator it = allPlatforms.begin();
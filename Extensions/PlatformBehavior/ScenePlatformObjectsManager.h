@@ -7,6 +7,7 @@ This project is released under the MIT License.
 #ifndef SCENEPLATFORMOBJECTSMANAGER_H
 #define SCENEPLATFORMOBJECTSMANAGER_H
 #include <map>
+#include <mutex>
 #include <set>
 #include "GDCpp/Runtime/RuntimeScene.h"
 class PlatformBehavior;
@@ -17,10 +18,18 @@ class PlatformBehavior;
 class ScenePlatformObjectsManager {
  public:
   /**
-   * \brief Map containing, for each RuntimeScene, its associated
-   * ScenePlatformObjectsManager.
+   * \brief Return the manager associated with the scene, creating it if
+   * needed.
+   *
+   * \note The managers can be accessed by different threads, as scenes can
+   * be loaded by another thread (see SceneStack::Preload).
    */
-  static std::map<RuntimeScene*, ScenePlatformObjectsManager> managers;
+  static ScenePlatformObjectsManager& Get(RuntimeScene& scene);
+
+  /**
+   * \brief Destroy the manager associated with the scene.
+   */
+  static void Remove(RuntimeScene& scene);
 
   ScenePlatformObjectsManager(){};
   virtual ~ScenePlatformObjectsManager();
@@ -45,6 +54,9 @@ class ScenePlatformObjectsManager {
  private:
   std::set<PlatformBehavior*>
       allPlatforms;  ///< The list of all platforms of the scene.
+  static std::map<RuntimeScene*, ScenePlatformObjectsManager>
+      managers;  ///< The manager associated with each RuntimeScene.
+  static std::recursive_mutex managersMutex;  ///< Protect managers.
 };
 
 #endif
@@ -0,0 +1,92 @@
+/**
+
+GDevelop - Platform Behavior Extension
+Copyright (c) 2013-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+/**
+ * @file Tests for the Platform Behavior extension.
+ */
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/BehaviorsScheduler.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "../PlatformerObjectBehavior.h"
+#include "../../TopDownMovementBehavior/TopDownMovementBehavior.h"
+
+namespace {
+/**
+ * Run the behaviors of thousands of platformer and top-down objects, created
+ * alternately, and return the time spent (in microseconds).
+ */
+long long RunBehaviors(BehaviorsScheduler::Order order,
+                       std::vector<sf::Vector2f> & positions) {
+	RuntimeGame game;
+	RuntimeScene scene(NULL, &game);
+	scene.GetBehaviorsScheduler().SetOrder(order);
+
+	gd::Object playerObj("Player");
+	PlatformerObjectBehavior * platformerBehavior = new PlatformerObjectBehavior();
+	platformerBehavior->SetName("PlatformerObject");
+	playerObj.AddBehavior(platformerBehavior);
+	gd::Object enemyObj("Enemy");
+	TopDownMovementBehavior * topDownBehavior = new TopDownMovementBehavior();
+	topDownBehavior->SetName("TopDownMovement");
+	enemyObj.AddBehavior(topDownBehavior);
+
+	std::vector<std::unique_ptr<RuntimeObject>> ownedObjects;
+	std::vector<RuntimeObject*> objects;
+	std::vector<PlatformerObjectBehavior*> platformers;
+	std::vector<TopDownMovementBehavior*> topDowns;
+	for (std::size_t i = 0; i < 5000; ++i) {
+		ownedObjects.emplace_back(new RuntimeObject(scene, playerObj));
+		platformers.push_back(static_cast<PlatformerObjectBehavior*>(
+			ownedObjects.back()->GetBehaviorRawPointer("PlatformerObject")));
+		ownedObjects.emplace_back(new RuntimeObject(scene, enemyObj));
+		topDowns.push_back(static_cast<TopDownMovementBehavior*>(
+			ownedObjects.back()->GetBehaviorRawPointer("TopDownMovement")));
+	}
+	for (auto & object : ownedObjects) objects.push_back(object.get());
+
+	auto start = std::chrono::steady_clock::now();
+	for (std::size_t frame = 0; frame < 60; ++frame) {
+		scene.GetTimeManager().Update(16666, 10);
+		for (PlatformerObjectBehavior * behavior : platformers) behavior->SimulateRightKey();
+		for (TopDownMovementBehavior * behavior : topDowns) behavior->SimulateDownKey();
+
+		scene.GetBehaviorsScheduler().StepPreEvents(scene, objects);
+		scene.GetBehaviorsScheduler().StepPostEvents(scene, objects);
+	}
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start);
+
+	positions.clear();
+	for (RuntimeObject * object : objects)
+		positions.push_back(sf::Vector2f(object->GetX(), object->GetY()));
+
+	return duration.count();
+}
+}
+
+TEST_CASE( "PlatformBehavior benchmark", "[.][benchmark]" ) {
+	std::vector<sf::Vector2f> objectsOrderPositions;
+	long long objectsOrderTime =
+		RunBehaviors(BehaviorsScheduler::ObjectsOrder, objectsOrderPositions);
+	std::cout << "ObjectsOrder: " << objectsOrderTime << "us" << std::endl;
+
+	std::vector<sf::Vector2f> behaviorsTypesOrderPositions;
+	long long behaviorsTypesOrderTime =
+		RunBehaviors(BehaviorsScheduler::BehaviorsTypesOrder, behaviorsTypesOrderPositions);
+	std::cout << "BehaviorsTypesOrder: " << behaviorsTypesOrderTime << "us" << std::endl;
+
+	//Objects don't interact, so the order of the behaviors must not change their moves.
+	REQUIRE(objectsOrderPositions[0].x > 0); //The platformer object moved to the right
+	REQUIRE(objectsOrderPositions[1].y > 0); //The top-down object moved down
+	REQUIRE(objectsOrderPositions == behaviorsTypesOrderPositions);
+}
@@ -83,9 +83,12 @@ bool SoundWrapper::LoadFromFileImpl(const gd::String &filename,
                                     const RuntimeScene &scene) {
 #if !defined(GD_IDE_ONLY)
   if (gd::ResourcesLoader::Get()->HasFile(filename)) {
-    if (m_buffer.loadFromMemory(
-            gd::ResourcesLoader::Get()->LoadBinaryFile(filename),
-            gd::ResourcesLoader::Get()->GetBinaryFileSize(filename))) {
+    // The sound buffer copies the samples, so the file can be released.
+    const char *file = gd::ResourcesLoader::Get()->LoadBinaryFile(filename);
+    bool loaded = m_buffer.loadFromMemory(
+        file, gd::ResourcesLoader::Get()->GetBinaryFileSize(filename));
+    gd::ResourcesLoader::Get()->ReleaseBinaryFile(filename, file);
+    if (loaded) {
       m_sound.setBuffer(m_buffer);
       return true;
     }
@@ -158,9 +161,10 @@ bool MusicWrapper::LoadFromFileImpl(const gd::String &filename,
                                     const RuntimeScene &scene) {
 #if !defined(GD_IDE_ONLY)
   if (gd::ResourcesLoader::Get()->HasFile(filename)) {
-    if (m_music.openFromMemory(
-            gd::ResourcesLoader::Get()->LoadBinaryFile(filename),
-            gd::ResourcesLoader::Get()->GetBinaryFileSize(filename))) {
+    // The music is read progressively from the resource file, without
+    // keeping the whole file in memory.
+    m_stream.reset(gd::ResourcesLoader::Get()->OpenStream(filename));
+    if (m_stream && m_music.openFromStream(*m_stream)) {
       return true;
     }
   } else
@@ -10,7 +10,9 @@ This project is released under the MIT License.
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/System/InputStream.hpp>
 #include <SFML/System/Vector3.hpp>
+#include <memory>
 
 #include "GDCpp/Runtime/RuntimeScene.h"
 
@@ -144,6 +146,8 @@ class MusicWrapper : public SoundWrapperBase {
                                 const RuntimeScene &scene);
 
  private:
+  std::unique_ptr<sf::InputStream> m_stream;  ///< The stream the music is
+                                              ///< read from, if any.
   sf::Music m_music;
 };
 
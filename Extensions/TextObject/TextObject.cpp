@@ -188,14 +188,13 @@ void RuntimeTextObject::OnPositionChanged() {
 /**
  * RuntimeTextObject provides a basic bounding box.
  */
-std::vector<Polygon2d> RuntimeTextObject::GetHitBoxes() const {
-  std::vector<Polygon2d> mask;
-  Polygon2d rectangle = Polygon2d::CreateRectangle(GetWidth(), GetHeight());
-  rectangle.Rotate(GetAngle() / 180 * 3.14159);
-  rectangle.Move(GetX() + GetCenterX(), GetY() + GetCenterY());
-
-  mask.push_back(rectangle);
-  return mask;
+const std::vector<Polygon2d>& RuntimeTextObject::GetHitBoxes() const {
+  hitBoxes.resize(1);
+  hitBoxes[0] = Polygon2d::CreateRectangle(GetWidth(), GetHeight());
+  hitBoxes[0].Rotate(GetAngle() / 180 * 3.14159);
+  hitBoxes[0].Move(GetX() + GetCenterX(), GetY() + GetCenterY());
+
+  return hitBoxes;
 }
 
 /**
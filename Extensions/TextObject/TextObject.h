@@ -136,6 +136,7 @@ class GD_EXTENSION_API RuntimeTextObject : public RuntimeObject {
 
   virtual float GetWidth() const;
   virtual float GetHeight() const;
+  virtual bool IsDrawnInsideAABB() const { return true; }
 
   virtual float GetDrawableX() const;
   virtual float GetDrawableY() const;
@@ -188,7 +189,7 @@ class GD_EXTENSION_API RuntimeTextObject : public RuntimeObject {
   unsigned int GetColorG() const { return text.getFillColor().g; };
   unsigned int GetColorB() const { return text.getFillColor().b; };
 
-  virtual std::vector<Polygon2d> GetHitBoxes() const;
+  virtual const std::vector<Polygon2d>& GetHitBoxes() const;
 
 #if defined(GD_IDE_ONLY)
   virtual void GetPropertyForDebugger(std::size_t propertyNb,
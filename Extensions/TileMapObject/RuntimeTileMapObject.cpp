@@ -132,14 +132,15 @@ std::size_t RuntimeTileMapObject::GetNumberOfProperties() const
 }
 #endif
 
-std::vector<Polygon2d> RuntimeTileMapObject::GetHitBoxes() const
+const std::vector<Polygon2d>& RuntimeTileMapObject::GetHitBoxes() const
 {
     return hitboxes;
 }
 
-std::vector<Polygon2d> RuntimeTileMapObject::GetHitBoxes(sf::FloatRect hint) const
+const std::vector<Polygon2d>& RuntimeTileMapObject::GetHitBoxes(sf::FloatRect hint) const
 {
-    std::vector<Polygon2d> polygons;
+    std::vector<Polygon2d>& polygons = hitBoxes; //Hitboxes intersecting with the hint.
+    polygons.clear();
 
     if( !hint.intersects( sf::FloatRect(GetX(), GetY(), GetWidth(), GetHeight()) ) )
         return polygons;
@@ -264,11 +265,11 @@ void RuntimeTileMapObject::ChangeTexture(const gd::String &textureName, RuntimeS
     needGeneration = true;
 }
 
-bool GD_EXTENSION_API SingleTileCollision(std::map<gd::String, std::vector<RuntimeObject*>*> tileMapList,
+bool GD_EXTENSION_API SingleTileCollision(RuntimeObjectsLists tileMapList,
                          int layer,
                          int column,
                          int row,
-                         std::map<gd::String, std::vector<RuntimeObject*>*> objectLists,
+                         RuntimeObjectsLists objectLists,
                          bool conditionInverted)
 {
     return TwoObjectListsTest(tileMapList, objectLists, conditionInverted, [layer, column, row](RuntimeObject* tileMapObject_, RuntimeObject * object) {
@@ -286,9 +287,9 @@ bool GD_EXTENSION_API SingleTileCollision(std::map<gd::String, std::vector<Runti
                         tileMapObject->GetY() + row * tileMapObject->tileSet.Get().tileSize.y);
 
         //Get the object hitbox
-        std::vector<Polygon2d> objectHitboxes = object->GetHitBoxes();
+        const std::vector<Polygon2d>& objectHitboxes = object->GetHitBoxes();
 
-        for(std::vector<Polygon2d>::iterator hitboxIt = objectHitboxes.begin(); hitboxIt != objectHitboxes.end(); ++hitboxIt)
+        for(std::vector<Polygon2d>::const_iterator hitboxIt = objectHitboxes.begin(); hitboxIt != objectHitboxes.end(); ++hitboxIt)
         {
             if(PolygonCollisionTest(tileHitbox, *hitboxIt, false).collision)
             {
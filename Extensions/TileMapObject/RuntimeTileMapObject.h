@@ -43,6 +43,7 @@ public :
 
     virtual float GetWidth() const;
     virtual float GetHeight() const;
+    virtual bool IsDrawnInsideAABB() const {return true;};
 
     virtual float GetAngle() const {return 0;};
     virtual bool SetAngle(float ang) {return false;};
@@ -58,8 +59,8 @@ public :
     virtual std::size_t GetNumberOfProperties() const;
     #endif
 
-    virtual std::vector<Polygon2d> GetHitBoxes() const;
-    virtual std::vector<Polygon2d> GetHitBoxes(sf::FloatRect hint) const;
+    virtual const std::vector<Polygon2d>& GetHitBoxes() const;
+    virtual const std::vector<Polygon2d>& GetHitBoxes(sf::FloatRect hint) const;
 
     float GetTileWidth() const;
     float GetTileHeight() const;
@@ -96,11 +97,11 @@ private:
     float oldY;
 };
 
-bool GD_EXTENSION_API SingleTileCollision(std::map<gd::String, std::vector<RuntimeObject*>*> tileMapList,
+bool GD_EXTENSION_API SingleTileCollision(RuntimeObjectsLists tileMapList,
                          int layer,
                          int column,
                          int row,
-                         std::map<gd::String, std::vector<RuntimeObject*>*> objectLists,
+                         RuntimeObjectsLists objectLists,
                          bool conditionInverted);
 
 #endif
@@ -100,6 +100,7 @@ class GD_EXTENSION_API RuntimeTiledSpriteObject : public RuntimeObject {
 
   virtual float GetWidth() const { return width; };
   virtual float GetHeight() const { return height; };
+  virtual bool IsDrawnInsideAABB() const { return true; }
 
   virtual float GetAngle() const { return angle; };
   virtual bool SetAngle(float ang) {
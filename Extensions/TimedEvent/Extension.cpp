@@ -224,9 +224,9 @@ class Extension : public ExtensionBase {
                               gd::String& value) const {
     std::size_t i = 0;
     std::map<gd::String, ManualTimer>::const_iterator end =
-        TimedEventsManager::managers[&scene].timedEvents.end();
+        TimedEventsManager::Get(scene).timedEvents.end();
     for (std::map<gd::String, ManualTimer>::iterator iter =
-             TimedEventsManager::managers[&scene].timedEvents.begin();
+             TimedEventsManager::Get(scene).timedEvents.begin();
          iter != end;
          ++iter) {
       if (propertyNb == i) {
@@ -253,9 +253,9 @@ class Extension : public ExtensionBase {
                       gd::String newValue) {
     std::size_t i = 0;
     std::map<gd::String, ManualTimer>::const_iterator end =
-        TimedEventsManager::managers[&scene].timedEvents.end();
+        TimedEventsManager::Get(scene).timedEvents.end();
     for (std::map<gd::String, ManualTimer>::iterator iter =
-             TimedEventsManager::managers[&scene].timedEvents.begin();
+             TimedEventsManager::Get(scene).timedEvents.begin();
          iter != end;
          ++iter) {
       if (propertyNb == i) {
@@ -271,12 +271,12 @@ class Extension : public ExtensionBase {
   }
 
   std::size_t GetNumberOfProperties(RuntimeScene& scene) const {
-    return TimedEventsManager::managers[&scene].timedEvents.size();
+    return TimedEventsManager::Get(scene).timedEvents.size();
   }
 #endif
 
   void SceneLoaded(RuntimeScene& scene) {
-    TimedEventsManager::managers[&scene].timedEvents.clear();
+    TimedEventsManager::Get(scene).timedEvents.clear();
   }
 };
 
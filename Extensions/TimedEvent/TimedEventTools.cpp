@@ -14,14 +14,14 @@ namespace TimedEvents {
 
 signed long long GD_EXTENSION_API
 UpdateAndGetTimeOf(RuntimeScene& scene, gd::String timedEventName) {
-  TimedEventsManager& manager = TimedEventsManager::managers[&scene];
+  TimedEventsManager& manager = TimedEventsManager::Get(scene);
   manager.timedEvents[timedEventName].UpdateTime(
       scene.GetTimeManager().GetElapsedTime());
   return manager.timedEvents[timedEventName].GetTime();
 }
 
 void GD_EXTENSION_API Reset(RuntimeScene& scene, gd::String timedEventName) {
-  TimedEventsManager& manager = TimedEventsManager::managers[&scene];
+  TimedEventsManager& manager = TimedEventsManager::Get(scene);
   manager.timedEvents[timedEventName].Reset();
 }
 
@@ -9,3 +9,9 @@ This project is released under the MIT License.
 
 std::map<RuntimeScene*, TimedEventsManager>
     TimedEventsManager::managers;  // List of managers associated with scenes.
+std::mutex TimedEventsManager::managersMutex;
+
+TimedEventsManager& TimedEventsManager::Get(RuntimeScene& scene) {
+  std::lock_guard<std::mutex> lock(managersMutex);
+  return managers[&scene];
+}
@@ -8,6 +8,7 @@ This project is released under the MIT License.
 #ifndef TIMEDEVENTMANAGER_H
 #define TIMEDEVENTMANAGER_H
 #include <map>
+#include <mutex>
 #include <string>
 #include "GDCpp/Runtime/ManualTimer.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
@@ -19,8 +20,19 @@ class TimedEventsManager {
 
   std::map<gd::String, ManualTimer> timedEvents;
 
+  /**
+   * \brief Return the manager associated with the scene, creating it if
+   * needed.
+   *
+   * \note The managers can be accessed by different threads, as scenes can
+   * be loaded by another thread (see SceneStack::Preload).
+   */
+  static TimedEventsManager& Get(RuntimeScene& scene);
+
+ private:
   static std::map<RuntimeScene*, TimedEventsManager>
       managers;  // List of managers associated with scenes.
+  static std::mutex managersMutex;
 };
 
 #endif  // TIMEDEVENTMANAGER_H
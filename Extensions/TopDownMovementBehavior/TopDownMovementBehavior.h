@@ -30,6 +30,7 @@ class GD_EXTENSION_API TopDownMovementBehavior : public Behavior {
   TopDownMovementBehavior();
   virtual ~TopDownMovementBehavior(){};
   virtual Behavior* Clone() const { return new TopDownMovementBehavior(*this); }
+  virtual bool CanStepInParallel() const { return true; }
 
   // Configuration:
   bool DiagonalsAllowed() const { return allowDiagonals; };
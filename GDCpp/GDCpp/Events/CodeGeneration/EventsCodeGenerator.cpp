@@ -72,6 +72,7 @@ gd::String EventsCodeGenerator::GenerateObjectBehaviorFunctionCall(
     gd::String defaultOutput,
     gd::EventsCodeGenerationContext& context) {
   bool castNeeded = !autoInfo.className.empty();
+  gd::String behaviorSlot = DeclareBehaviorSlot(*this, behaviorName);
 
   if (codeInfo.staticFunction) {
     if (!castNeeded)
@@ -84,24 +85,24 @@ gd::String EventsCodeGenerator::GenerateObjectBehaviorFunctionCall(
              !context.GetCurrentObject().empty()) {
     if (!castNeeded)
       return "(" + ManObjListName(objectListName) +
-             "[i]->GetBehaviorRawPointer(\"" + behaviorName + "\")->" +
+             "[i]->GetBehaviorRawPointer(" + behaviorSlot + ")->" +
              codeInfo.functionCallName + "(" + parametersStr + "))";
     else
       return "(static_cast<" + autoInfo.className + "*>(" +
-             ManObjListName(objectListName) + "[i]->GetBehaviorRawPointer(\"" +
-             behaviorName + "\"))->" + codeInfo.functionCallName + "(" +
+             ManObjListName(objectListName) + "[i]->GetBehaviorRawPointer(" +
+             behaviorSlot + "))->" + codeInfo.functionCallName + "(" +
              parametersStr + "))";
   } else {
     if (!castNeeded)
       return "(( " + ManObjListName(objectListName) + ".empty() ) ? " +
              defaultOutput + " :" + ManObjListName(objectListName) +
-             "[0]->GetBehaviorRawPointer(\"" + behaviorName + "\")->" +
+             "[0]->GetBehaviorRawPointer(" + behaviorSlot + ")->" +
              codeInfo.functionCallName + "(" + parametersStr + "))";
     else
       return "(( " + ManObjListName(objectListName) + ".empty() ) ? " +
              defaultOutput + " : " + "static_cast<" + autoInfo.className +
              "*>(" + ManObjListName(objectListName) +
-             "[0]->GetBehaviorRawPointer(\"" + behaviorName + "\"))->" +
+             "[0]->GetBehaviorRawPointer(" + behaviorSlot + "))->" +
              codeInfo.functionCallName + "(" + parametersStr + "))";
   }
 }
@@ -167,17 +168,18 @@ gd::String EventsCodeGenerator::GenerateBehaviorCondition(
     bool conditionInverted,
     gd::EventsCodeGenerationContext& context) {
   gd::String conditionCode;
+  gd::String behaviorSlot = DeclareBehaviorSlot(*this, behaviorName);
 
   // Prepare call
   // Add a static_cast if necessary
   gd::String objectFunctionCallNamePart =
       (!instrInfos.parameters[1].supplementaryInformation.empty())
           ? "static_cast<" + autoInfo.className + "*>(" +
-                ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(\"" +
-                behaviorName + "\"))->" +
+                ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(" +
+                behaviorSlot + "))->" +
                 instrInfos.codeExtraInformation.functionCallName
-          : ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(\"" +
-                behaviorName + "\")->" +
+          : ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(" +
+                behaviorSlot + ")->" +
                 instrInfos.codeExtraInformation.functionCallName;
 
   // Create call
@@ -282,16 +284,17 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
     const gd::InstructionMetadata& instrInfos,
     gd::EventsCodeGenerationContext& context) {
   gd::String actionCode;
+  gd::String behaviorSlot = DeclareBehaviorSlot(*this, behaviorName);
 
   // Prepare call
   // Add a static_cast if necessary
   gd::String objectPart =
       (!instrInfos.parameters[1].supplementaryInformation.empty())
           ? "static_cast<" + autoInfo.className + "*>(" +
-                ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(\"" +
-                behaviorName + "\"))->"
-          : ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(\"" +
-                behaviorName + "\")->";
+                ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(" +
+                behaviorSlot + "))->"
+          : ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(" +
+                behaviorSlot + ")->";
 
   // Create call
   gd::String call;
@@ -341,6 +344,40 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
   return actionCode;
 }
 
+gd::String EventsCodeGenerator::DeclareObjectSlot(
+    gd::EventsCodeGenerator& codeGenerator, const gd::String& objectName) {
+  gd::String slotName = ManObjListName(objectName) + "Slot";
+  codeGenerator.AddGlobalDeclaration(
+      "static RuntimeObjectSlot " + slotName + "(" +
+      codeGenerator.ConvertToStringExplicit(objectName) + ");");
+
+  return slotName;
+}
+
+gd::String EventsCodeGenerator::DeclareBehaviorSlot(
+    gd::EventsCodeGenerator& codeGenerator, const gd::String& behaviorName) {
+  gd::String slotName = ManObjListName(behaviorName) + "BehaviorSlot";
+  codeGenerator.AddGlobalDeclaration(
+      "static RuntimeBehaviorSlot " + slotName + "(" +
+      codeGenerator.ConvertToStringExplicit(behaviorName) + ");");
+
+  return slotName;
+}
+
+gd::String EventsCodeGenerator::GenerateTriggerOnceConditionsDeclaration()
+    const {
+  if (triggerOnceConditionsCount == 0) return "";
+
+  return "static RuntimeTriggerOnceConditions triggerOnceConditions(" +
+         gd::String::From(triggerOnceConditionsCount) + ");\n";
+}
+
+gd::String EventsCodeGenerator::GenerateAllInstancesGetter(
+    const gd::String& objectName) {
+  return "runtimeContext->GetObjectsRawPointers(" +
+         DeclareObjectSlot(*this, objectName) + ")";
+}
+
 gd::String EventsCodeGenerator::GenerateParameterCodes(
     const gd::String& parameter,
     const gd::ParameterMetadata& metadata,
@@ -361,8 +398,9 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(
     argOutput += "runtimeContext->ClearObjectListsMap()";
     for (std::size_t i = 0; i < realObjects.size(); ++i) {
       context.ObjectsListNeeded(realObjects[i]);
-      argOutput += ".AddObjectListToMap(\"" + ConvertToString(realObjects[i]) +
-                   "\", " + ManObjListName(realObjects[i]) + ")";
+      argOutput += ".AddObjectListToMap(" +
+                   DeclareObjectSlot(*this, realObjects[i]) + ", " +
+                   ManObjListName(realObjects[i]) + ")";
     }
     argOutput += ".ReturnObjectListsMap()";
   }
@@ -373,8 +411,9 @@ gd::String EventsCodeGenerator::GenerateParameterCodes(
     argOutput += "runtimeContext->ClearObjectListsMap()";
     for (std::size_t i = 0; i < realObjects.size(); ++i) {
       context.EmptyObjectsListNeeded(realObjects[i]);
-      argOutput += ".AddObjectListToMap(\"" + ConvertToString(realObjects[i]) +
-                   "\", " + ManObjListName(realObjects[i]) + ")";
+      argOutput += ".AddObjectListToMap(" +
+                   DeclareObjectSlot(*this, realObjects[i]) + ", " +
+                   ManObjListName(realObjects[i]) + ")";
     }
     argOutput += ".ReturnObjectListsMap()";
   }
@@ -491,6 +530,7 @@ gd::String EventsCodeGenerator::GenerateSceneEventsCompleteCode(
        declaration != codeGenerator.GetCustomGlobalDeclaration().end();
        ++declaration)
     output += *declaration + "\n";
+  output += codeGenerator.GenerateTriggerOnceConditionsDeclaration();
 
   output += codeGenerator.GetCustomCodeOutsideMain() +
             "\n"
@@ -555,6 +595,7 @@ gd::String EventsCodeGenerator::GenerateExternalEventsCompleteCode(
        declaration != codeGenerator.GetCustomGlobalDeclaration().end();
        ++declaration)
     output += *declaration + "\n";
+  output += codeGenerator.GenerateTriggerOnceConditionsDeclaration();
 
   output += codeGenerator.GetCustomCodeOutsideMain() +
             "\n"
@@ -572,7 +613,8 @@ gd::String EventsCodeGenerator::GenerateExternalEventsCompleteCode(
 
 EventsCodeGenerator::EventsCodeGenerator(gd::Project& project,
                                          const gd::Layout& layout)
-    : gd::EventsCodeGenerator(project, layout, CppPlatform::Get()) {}
+    : gd::EventsCodeGenerator(project, layout, CppPlatform::Get()),
+      triggerOnceConditionsCount(0) {}
 
 EventsCodeGenerator::~EventsCodeGenerator() {}
 
@@ -58,6 +58,31 @@ class GD_API EventsCodeGenerator : public gd::EventsCodeGenerator {
    */
   void PreprocessEventList(gd::EventsList& listEvent);
 
+  /**
+   * \brief Declare (only once) a static RuntimeObjectSlot for an object.
+   * \return The name of the RuntimeObjectSlot.
+   */
+  static gd::String DeclareObjectSlot(gd::EventsCodeGenerator& codeGenerator,
+                                      const gd::String& objectName);
+
+  /**
+   * \brief Declare (only once) a static RuntimeBehaviorSlot for a behavior.
+   * \return The name of the RuntimeBehaviorSlot.
+   */
+  static gd::String DeclareBehaviorSlot(gd::EventsCodeGenerator& codeGenerator,
+                                        const gd::String& behaviorName);
+
+  /**
+   * \brief Return a new identifier for a "Trigger once" condition.
+   *
+   * Identifiers are consecutive in the code being generated (scene or external
+   * events), whose RuntimeTriggerOnceConditions is declared with the number of
+   * identifiers.
+   */
+  std::size_t GenerateTriggerOnceConditionId() {
+    return triggerOnceConditionsCount++;
+  }
+
   /**
    * \note This is unused for C++ code generation.
    */
@@ -70,6 +95,13 @@ class GD_API EventsCodeGenerator : public gd::EventsCodeGenerator {
   virtual gd::String GetCodeNamespace() { return ""; };
 
  protected:
+  /**
+   * \brief Generate the code to get all the instances of an object, using a
+   * static RuntimeObjectSlot declared for the object so that its name is
+   * resolved only once per scene.
+   */
+  virtual gd::String GenerateAllInstancesGetter(const gd::String& objectName);
+
   virtual gd::String GenerateParameterCodes(
       const gd::String& parameter,
       const gd::ParameterMetadata& metadata,
@@ -134,6 +166,15 @@ class GD_API EventsCodeGenerator : public gd::EventsCodeGenerator {
    */
   EventsCodeGenerator(gd::Project& project, const gd::Layout& layout);
   virtual ~EventsCodeGenerator();
+
+  /**
+   * \brief Generate the declaration of the RuntimeTriggerOnceConditions used
+   * by the "Trigger once" conditions, if any.
+   */
+  gd::String GenerateTriggerOnceConditionsDeclaration() const;
+
+  std::size_t triggerOnceConditionsCount;  ///< The number of "Trigger once"
+                                           ///< conditions generated.
 };
 
 #endif  // EventsCodeGenerator_H
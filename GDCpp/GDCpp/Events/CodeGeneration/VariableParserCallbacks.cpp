@@ -11,6 +11,7 @@
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCore/Events/CodeGeneration/ExpressionsCodeGeneration.h"
 #include "GDCore/Events/Parsers/VariableParser.h"
+#include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Metadata/ObjectMetadata.h"
 #include "GDCore/Extensions/Platform.h"
@@ -107,7 +108,14 @@ void VariableCodeGenerationCallbacks::OnRootVariable(gd::String variableName) {
 }
 
 void VariableCodeGenerationCallbacks::OnChildVariable(gd::String variableName) {
-  output += ".GetChild(\"" + variableName + "\")";
+  // Use a key, declared once, so that the child is found without comparing
+  // strings once it was accessed.
+  gd::String keyName = ManObjListName(variableName) + "ChildKey";
+  codeGenerator.AddGlobalDeclaration(
+      "static gd::VariableChildKey " + keyName + "(" +
+      codeGenerator.ConvertToStringExplicit(variableName) + ");");
+
+  output += ".GetChild(" + keyName + ")";
 }
 
 void VariableCodeGenerationCallbacks::OnChildSubscript(
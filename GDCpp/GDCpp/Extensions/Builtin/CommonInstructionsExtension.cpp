@@ -28,6 +28,7 @@
 #include "GDCore/Project/ObjectGroup.h"
 #include "GDCore/Project/Project.h"
 #include "GDCpp/Events/Builtin/CppCodeEvent.h"
+#include "GDCpp/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCpp/Extensions/Builtin/CommonInstructionsExtension.h"
 #include "GDCpp/Extensions/Builtin/CommonInstructionsTools.h"
 #include "GDCpp/Extensions/ExtensionBase.h"
@@ -215,9 +216,12 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
           [](gd::Instruction& instruction,
              gd::EventsCodeGenerator& codeGenerator,
              gd::EventsCodeGenerationContext& parentContext) {
-            size_t uniqueId = (size_t)&instruction;
-            return "conditionTrue = runtimeContext->TriggerOnce(" +
-                   gd::String::From(uniqueId) + ");\n";
+            std::size_t conditionId =
+                dynamic_cast<::EventsCodeGenerator&>(codeGenerator)
+                    .GenerateTriggerOnceConditionId();
+            return "conditionTrue = "
+                   "runtimeContext->TriggerOnce(triggerOnceConditions, " +
+                   gd::String::From(conditionId) + ");\n";
           });
 
   GetAllEvents()["BuiltinCommonInstructions::Standard"].SetCodeGenerator(
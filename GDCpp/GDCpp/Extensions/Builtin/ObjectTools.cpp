@@ -14,10 +14,31 @@
 
 using namespace std;
 
+namespace {
+/**
+ * \brief Return a square containing the circle centered on the object center
+ * and going through its corners, slightly enlarged to be safe from rounding
+ * errors.
+ *
+ * Objects with squares not overlapping can't be in collision (see
+ * RuntimeObject::IsCollidingWith).
+ */
+sf::FloatRect GetBoundingCircleSquare(RuntimeObject *obj) {
+  float width = obj->GetWidth();
+  float height = obj->GetHeight();
+  float radius = sqrt(width * width + height * height) / 2.0 + 1;
+
+  return sf::FloatRect(obj->GetDrawableX() + obj->GetCenterX() - radius,
+                       obj->GetDrawableY() + obj->GetCenterY() - radius,
+                       2 * radius,
+                       2 * radius);
+}
+}  // namespace
+
 double GD_API PickedObjectsCount(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists) {
+    RuntimeObjectsLists objectsLists) {
   std::size_t size = 0;
-  std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
+  RuntimeObjectsLists::const_iterator it =
       objectsLists.begin();
   for (; it != objectsLists.end(); ++it) {
     if (it->second == NULL) continue;
@@ -29,8 +50,8 @@ double GD_API PickedObjectsCount(
 }
 
 bool GD_API HitBoxesCollision(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    RuntimeObjectsLists objectsLists1,
+    RuntimeObjectsLists objectsLists2,
     bool conditionInverted,
     RuntimeScene & /*scene*/,
     bool ignoreTouchingEdges) {
@@ -38,14 +59,15 @@ bool GD_API HitBoxesCollision(
       objectsLists1,
       objectsLists2,
       conditionInverted,
+      GetBoundingCircleSquare,
       [ignoreTouchingEdges](RuntimeObject *obj1, RuntimeObject *obj2) {
         return obj1->IsCollidingWith(obj2, ignoreTouchingEdges);
       });
 }
 
 bool GD_API ObjectsTurnedToward(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    RuntimeObjectsLists objectsLists1,
+    RuntimeObjectsLists objectsLists2,
     float tolerance,
     bool conditionInverted) {
   return TwoObjectListsTest(
@@ -66,15 +88,26 @@ bool GD_API ObjectsTurnedToward(
 }
 
 float GD_API DistanceBetweenObjects(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    RuntimeObjectsLists objectsLists1,
+    RuntimeObjectsLists objectsLists2,
     float length,
     bool conditionInverted) {
+  // Objects at less than the given length from each other have their centers
+  // in squares of the same size overlapping.
+  float halfLength = fabs(length) / 2 + 1;
+  auto bounds = [halfLength](RuntimeObject *obj) {
+    return sf::FloatRect(obj->GetDrawableX() + obj->GetCenterX() - halfLength,
+                         obj->GetDrawableY() + obj->GetCenterY() - halfLength,
+                         2 * halfLength,
+                         2 * halfLength);
+  };
+
   length *= length;
   return TwoObjectListsTest(
       objectsLists1,
       objectsLists2,
       conditionInverted,
+      bounds,
       [length](RuntimeObject *obj1, RuntimeObject *obj2) {
         float X = obj1->GetDrawableX() + obj1->GetCenterX() -
                   (obj2->GetDrawableX() + obj2->GetCenterX());
@@ -86,8 +119,8 @@ float GD_API DistanceBetweenObjects(
 }
 
 bool GD_API
-MovesToward(std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-            std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+MovesToward(RuntimeObjectsLists objectsLists1,
+            RuntimeObjectsLists objectsLists2,
             float tolerance,
             bool conditionInverted) {
   return TwoObjectListsTest(
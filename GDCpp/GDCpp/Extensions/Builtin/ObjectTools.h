@@ -9,6 +9,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 #include "GDCpp/Runtime/String.h"
 
 class RuntimeScene;
@@ -18,8 +19,8 @@ class RuntimeObject;
  * Only used internally by GD events generated code.
  */
 bool GD_API ObjectsTurnedToward(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    RuntimeObjectsLists objectsLists1,
+    RuntimeObjectsLists objectsLists2,
     float tolerance,
     bool conditionInverted);
 
@@ -27,8 +28,8 @@ bool GD_API ObjectsTurnedToward(
  * Only used internally by GD events generated code.
  */
 bool GD_API HitBoxesCollision(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    RuntimeObjectsLists objectsLists1,
+    RuntimeObjectsLists objectsLists2,
     bool conditionInverted,
     RuntimeScene &scene,
     bool ignoreTouchingEdges = false);
@@ -37,14 +38,14 @@ bool GD_API HitBoxesCollision(
  * Only used internally by GD events generated code.
  */
 double GD_API PickedObjectsCount(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists);
+    RuntimeObjectsLists objectsLists);
 
 /**
  * Only used internally by GD events generated code.
  */
 float GD_API DistanceBetweenObjects(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    RuntimeObjectsLists objectsLists1,
+    RuntimeObjectsLists objectsLists2,
     float length,
     bool conditionInverted);
 
@@ -52,8 +53,8 @@ float GD_API DistanceBetweenObjects(
  * Only used internally by GD events generated code.
  */
 bool GD_API
-MovesToward(std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-            std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+MovesToward(RuntimeObjectsLists objectsLists1,
+            RuntimeObjectsLists objectsLists2,
             float tolerance,
             bool conditionInverted);
 
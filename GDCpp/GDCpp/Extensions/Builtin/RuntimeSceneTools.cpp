@@ -66,6 +66,11 @@ void GD_API PushScene(RuntimeScene &scene, gd::String newSceneName) {
   scene.RequestChange(RuntimeScene::SceneChange::PUSH_SCENE, newSceneName);
 }
 
+void GD_API PreloadScene(RuntimeScene &scene, gd::String sceneName) {
+  if (!scene.game->HasLayoutNamed(sceneName)) return;
+  scene.RequestPreload(sceneName);
+}
+
 void GD_API PopScene(RuntimeScene &scene) {
   scene.RequestChange(RuntimeScene::SceneChange::POP_SCENE);
 }
@@ -75,7 +80,7 @@ bool GD_API SceneJustBegins(RuntimeScene &scene) {
 }
 
 void GD_API MoveObjects(RuntimeScene &scene) {
-  RuntimeObjNonOwningPtrList allObjects =
+  const RuntimeObjNonOwningPtrList &allObjects =
       scene.objectsInstances.GetAllObjects();
 
   for (std::size_t id = 0; id < allObjects.size(); ++id) {
@@ -97,7 +102,7 @@ namespace {
 void DoCreateObjectOnScene(
     RuntimeScene &scene,
     gd::String objectName,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     float positionX,
     float positionY,
     const gd::String &layer) {
@@ -115,12 +120,13 @@ void DoCreateObjectOnScene(
 
   RuntimeObjSPtr newObject = std::unique_ptr<RuntimeObject>();
 
+  // Objects deleted from the scene are reused if possible.
   if (sceneObject !=
       scene.GetObjects().end())  // We check first scene's objects' list.
-    newObject = CppPlatform::Get().CreateRuntimeObject(scene, **sceneObject);
+    newObject = scene.GetObjectsPool().CreateObject(scene, **sceneObject);
   else if (globalObject !=
            scene.game->GetObjects().end())  // Then the global object list
-    newObject = CppPlatform::Get().CreateRuntimeObject(scene, **globalObject);
+    newObject = scene.GetObjectsPool().CreateObject(scene, **globalObject);
 
   if (newObject == std::unique_ptr<RuntimeObject>())
     return;  // Unable to create the object
@@ -131,7 +137,7 @@ void DoCreateObjectOnScene(
   newObject->SetLayer(layer);
 
   // Add object to scene and let it be concerned by futures actions
-  pickedObjectLists[objectName]->push_back(
+  pickedObjectLists.Get(objectName)->push_back(
       scene.objectsInstances.AddObject(std::move(newObject)));
 }
 
@@ -139,14 +145,14 @@ void DoCreateObjectOnScene(
 
 void GD_API CreateObjectOnScene(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     float positionX,
     float positionY,
     const gd::String &layer) {
   if (pickedObjectLists.empty()) return;
 
   ::DoCreateObjectOnScene(scene,
-                          pickedObjectLists.begin()->first,
+                          *pickedObjectLists.begin()->first,
                           pickedObjectLists,
                           positionX,
                           positionY,
@@ -155,12 +161,12 @@ void GD_API CreateObjectOnScene(
 
 void GD_API CreateObjectFromGroupOnScene(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     const gd::String &objectWanted,
     float positionX,
     float positionY,
     const gd::String &layer) {
-  if (pickedObjectLists[objectWanted] == nullptr)
+  if (pickedObjectLists.Get(objectWanted) == nullptr)
     return;  // Bail out if the object is not present in the specified group
 
   ::DoCreateObjectOnScene(
@@ -169,12 +175,12 @@ void GD_API CreateObjectFromGroupOnScene(
 
 bool GD_API PickAllObjects(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    RuntimeObjectsLists pickedObjectLists) {
   for (auto it = pickedObjectLists.begin(); it != pickedObjectLists.end();
        ++it) {
     if (it->second != nullptr) {
-      std::vector<RuntimeObject *> objectsOnScene =
-          scene.objectsInstances.GetObjectsRawPointers(it->first);
+      const std::vector<RuntimeObject *> &objectsOnScene =
+          scene.objectsInstances.GetObjectsRawPointers(*it->first);
 
       for (std::size_t j = 0; j < objectsOnScene.size(); ++j) {
         if (find(it->second->begin(), it->second->end(), objectsOnScene[j]) ==
@@ -189,7 +195,7 @@ bool GD_API PickAllObjects(
 
 bool GD_API PickRandomObject(
     RuntimeScene &,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    RuntimeObjectsLists pickedObjectLists) {
   // Create a list with all objects
   std::vector<RuntimeObject *> allObjects;
   for (auto it = pickedObjectLists.begin(); it != pickedObjectLists.end();
@@ -208,7 +214,7 @@ bool GD_API PickRandomObject(
 }
 
 bool GD_API PickNearestObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     double x,
     double y,
     bool inverted) {
@@ -238,7 +244,7 @@ bool GD_API PickNearestObject(
 }
 
 bool GD_API RaycastObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     float x,
     float y,
     float angle,
@@ -254,7 +260,7 @@ bool GD_API RaycastObject(
 }
 
 bool GD_API RaycastObjectToPosition(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     float x,
     float y,
     float endX,
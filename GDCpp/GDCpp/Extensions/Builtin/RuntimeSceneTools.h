@@ -4,6 +4,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 class RuntimeScene;
 namespace gd {
 class Variable;
@@ -47,6 +48,11 @@ void GD_API ReplaceScene(RuntimeScene &scene,
  */
 void GD_API PushScene(RuntimeScene &scene, gd::String newSceneName);
 
+/**
+ * Only used internally by GD events generated code.
+ */
+void GD_API PreloadScene(RuntimeScene &scene, gd::String sceneName);
+
 /**
  * Only used internally by GD events generated code.
  */
@@ -72,7 +78,7 @@ void GD_API DisableInputWhenFocusIsLost(RuntimeScene &scene, bool disable);
  */
 void GD_API CreateObjectOnScene(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     float positionX,
     float positionY,
     const gd::String &layer);
@@ -82,7 +88,7 @@ void GD_API CreateObjectOnScene(
  */
 void GD_API CreateObjectFromGroupOnScene(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     const gd::String &objectWanted,
     float positionX,
     float positionY,
@@ -95,7 +101,7 @@ void GD_API CreateObjectFromGroupOnScene(
  */
 bool GD_API PickAllObjects(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists);
+    RuntimeObjectsLists pickedObjectLists);
 
 /**
  * Only used internally by GD events generated code.
@@ -104,7 +110,7 @@ bool GD_API PickAllObjects(
  */
 bool GD_API PickRandomObject(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists);
+    RuntimeObjectsLists pickedObjectLists);
 
 /**
  * Only used internally by GD events generated code.
@@ -112,7 +118,7 @@ bool GD_API PickRandomObject(
  * \return true if an object was picked, false otherwise
  */
 bool GD_API PickNearestObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     double x,
     double y,
     bool inverted);
@@ -121,7 +127,7 @@ bool GD_API PickNearestObject(
  * Only used internally by GD events generated code.
  */
 bool GD_API RaycastObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     float x,
     float y,
     float angle,
@@ -134,7 +140,7 @@ bool GD_API RaycastObject(
  * Only used internally by GD events generated code.
  */
 bool GD_API RaycastObjectToPosition(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     float x,
     float y,
     float targetX,
@@ -19,8 +19,8 @@ using namespace std;
  * Test a collision between two sprites objects
  */
 bool GD_API SpriteCollision(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    RuntimeObjectsLists objectsLists1,
+    RuntimeObjectsLists objectsLists2,
     bool conditionInverted) {
   return TwoObjectListsTest(objectsLists1,
                             objectsLists2,
@@ -4,6 +4,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 
 #include "GDCpp/Runtime/String.h"
 
@@ -11,8 +12,8 @@ class RuntimeScene;
 class RuntimeObject;
 
 bool GD_API SpriteCollision(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    RuntimeObjectsLists objectsLists1,
+    RuntimeObjectsLists objectsLists2,
     bool conditionInverted);
 
 #endif  // SPRITETOOLS_H
@@ -46,6 +46,8 @@ public:
     unsigned long int lastRenderingTime; ///< Time used by rendering during the last frame
     unsigned long int totalSceneTime; ///< Total time used by events and rendering since the beginning.
     unsigned long int totalEventsTime; ///< Total time used by events since the beginning.
+    std::size_t lastDrawnObjectsCount; ///< Number of objects drawn during the last frame
+    std::size_t lastCulledObjectsCount; ///< Number of objects not drawn during the last frame as they were outside the cameras
 
     btClock eventsClock; ///< Used to compute time used by events during the frame
     btClock renderingClock; ///< Used to compute time used by rendering during the frame
@@ -317,7 +317,11 @@ void ProfileDlg::UpdateGUI() {
   std::size_t currentObjectCount =
       sceneCanvas.GetRuntimeScene().objectsInstances.GetAllObjects().size();
   objectsCountTxt->SetLabel(_("Number of objects:") +
-                            gd::String::From(currentObjectCount));
+                            gd::String::From(currentObjectCount) + " (" +
+                            _("drawn:") +
+                            gd::String::From(lastDrawnObjectsCount) + ", " +
+                            _("outside the cameras:") +
+                            gd::String::From(lastCulledObjectsCount) + ")");
 
   // Update events data
   eventsData.push_front(lastEventsTime / 1000.0f);
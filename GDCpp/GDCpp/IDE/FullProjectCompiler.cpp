@@ -24,6 +24,7 @@
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/DependenciesAnalyzer.h"
 #include "GDCore/IDE/Project/ResourcesMergingHelper.h"
+#include "GDCore/IDE/Project/SpritesAtlasPacker.h"
 #include "GDCore/IDE/ProjectFileWriter.h"
 #include "GDCore/IDE/ProjectStripper.h"
 #include "GDCore/IDE/wxTools/SafeYield.h"
@@ -220,6 +221,13 @@ void FullProjectCompiler::LaunchProjectCompilation() {
   // Prepare resources to copy
   diagnosticManager.OnMessage(_("Preparing resources..."));
 
+  // Pack the images of sprites in a few texture atlases, so that the game
+  // loads less textures and can draw more sprites in a single draw call.
+  diagnosticManager.OnMessage(_("Packing sprites images..."));
+  gd::String atlasDir = GetTempDir() + "Atlas";
+  ClearDirectory(atlasDir);
+  gd::SpritesAtlasPacker::PackProjectSprites(game, atlasDir);
+
   // Add resources
   game.ExposeResources(resourcesMergingHelper);
 
@@ -381,9 +389,9 @@ void FullProjectCompiler::LaunchProjectCompilation() {
     }
   }
 
-  // Create the file containing the resources
+  // Create the file containing the resources, compressed
   DatFile gameDatFile;
-  gameDatFile.Create(files, tempDir, tempDir + "/gam.egd");
+  gameDatFile.Create(files, tempDir, tempDir + "/gam.egd", true);
 
   // Remove resources that we just merged
   {
@@ -0,0 +1,96 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/BehaviorsScheduler.h"
+#include "GDCpp/Runtime/Project/Behavior.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/ThreadPool.h"
+
+BehaviorsScheduler::BehaviorsScheduler() : order(ObjectsOrder) {}
+
+BehaviorsScheduler::~BehaviorsScheduler() {}
+
+void BehaviorsScheduler::SetThreadsCount(std::size_t threadsCount) {
+  if (threadsCount == GetThreadsCount()) return;
+
+  threadPool.reset(threadsCount > 1 ? new ThreadPool(threadsCount) : NULL);
+}
+
+std::size_t BehaviorsScheduler::GetThreadsCount() const {
+  return threadPool ? threadPool->GetThreadsCount() : 1;
+}
+
+void BehaviorsScheduler::StepPreEvents(
+    RuntimeScene& scene, const std::vector<RuntimeObject*>& objects) {
+  if (order == ObjectsOrder) {
+    for (std::size_t id = 0, count = objects.size(); id < count; ++id)
+      objects[id]->DoBehaviorsPreEvents(scene);
+    return;
+  }
+
+  UpdateBatches(objects);
+  StepBatches(scene, true);
+}
+
+void BehaviorsScheduler::StepPostEvents(
+    RuntimeScene& scene, const std::vector<RuntimeObject*>& objects) {
+  if (order == ObjectsOrder) {
+    for (std::size_t id = 0, count = objects.size(); id < count; ++id)
+      objects[id]->DoBehaviorsPostEvents(scene);
+    return;
+  }
+
+  UpdateBatches(objects);
+  StepBatches(scene, false);
+}
+
+void BehaviorsScheduler::StepBatches(RuntimeScene& scene, bool preEvents) {
+  for (Batch& batch : batches) {
+    std::vector<gd::Behavior*>& behaviors = batch.behaviors;
+    auto step = [&scene, &behaviors, preEvents](std::size_t begin,
+                                                std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        if (preEvents)
+          behaviors[i]->StepPreEvents(scene);
+        else
+          behaviors[i]->StepPostEvents(scene);
+      }
+    };
+
+    if (!threadPool || !batch.parallel) {
+      step(0, behaviors.size());
+      continue;
+    }
+
+    scene.objectsInstances.DeferChanges();
+    threadPool->ParallelFor(behaviors.size(), 64, step);
+    scene.objectsInstances.ApplyDeferredChanges();
+  }
+}
+
+void BehaviorsScheduler::UpdateBatches(
+    const std::vector<RuntimeObject*>& objects) {
+  for (Batch& batch : batches) batch.behaviors.clear();
+
+  // Objects of the same type often follow each other, so the batch of the
+  // previous behavior is tried first.
+  std::size_t batchIndex = 0;
+  for (RuntimeObject* object : objects) {
+    for (auto& behavior : object->GetAllBehaviors()) {
+      const std::type_info& type = typeid(*behavior);
+      if (batchIndex >= batches.size() || *batches[batchIndex].type != type) {
+        batchIndex = 0;
+        while (batchIndex < batches.size() && *batches[batchIndex].type != type)
+          ++batchIndex;
+
+        if (batchIndex == batches.size())
+          batches.push_back(Batch(type, behavior->CanStepInParallel()));
+      }
+
+      batches[batchIndex].behaviors.push_back(behavior.get());
+    }
+  }
+}
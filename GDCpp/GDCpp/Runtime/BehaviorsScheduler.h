@@ -0,0 +1,120 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCPP_BEHAVIORSSCHEDULER_H
+#define GDCPP_BEHAVIORSSCHEDULER_H
+
+#include <memory>
+#include <typeinfo>
+#include <vector>
+class RuntimeObject;
+class RuntimeScene;
+class ThreadPool;
+namespace gd {
+class Behavior;
+}
+
+/**
+ * \brief Run the behaviors of the objects of a scene, before and after the
+ * events.
+ *
+ * By default, the behaviors are run object after object (ObjectsOrder). With
+ * BehaviorsTypesOrder, the behaviors are grouped by type and the behaviors of
+ * each type are run one after the other (in the order of their objects), so
+ * that the same code is run for all of them instead of alternating between the
+ * code of each type of behavior.
+ *
+ * In BehaviorsTypesOrder, the behaviors of the types that can be run in
+ * parallel (see gd::Behavior::CanStepInParallel) are run by a pool of threads,
+ * if SetThreadsCount was called with more than one thread. The objects created
+ * or deleted by these behaviors are added or removed from the scene after all
+ * the behaviors of the type were run.
+ *
+ * \see RuntimeScene::GetBehaviorsScheduler
+ */
+class GD_API BehaviorsScheduler {
+ public:
+  enum Order {
+    ObjectsOrder,        ///< The behaviors of each object are run one after
+                         ///< the other.
+    BehaviorsTypesOrder  ///< The behaviors of each type are run one after the
+                         ///< other.
+  };
+
+  BehaviorsScheduler();
+  ~BehaviorsScheduler();
+  BehaviorsScheduler(const BehaviorsScheduler&) = delete;
+  BehaviorsScheduler& operator=(const BehaviorsScheduler&) = delete;
+
+  /**
+   * \brief Change the order in which the behaviors are run.
+   */
+  void SetOrder(Order order_) { order = order_; }
+
+  /**
+   * \brief Return the order in which the behaviors are run.
+   */
+  Order GetOrder() const { return order; }
+
+  /**
+   * \brief Change the number of threads running the behaviors that can be run
+   * in parallel, including the main thread (1 by default, i.e: no other
+   * threads).
+   */
+  void SetThreadsCount(std::size_t threadsCount);
+
+  /**
+   * \brief Return the number of threads running the behaviors that can be run
+   * in parallel, including the main thread.
+   */
+  std::size_t GetThreadsCount() const;
+
+  /**
+   * \brief Run the behaviors of the objects before the events.
+   */
+  void StepPreEvents(RuntimeScene& scene,
+                     const std::vector<RuntimeObject*>& objects);
+
+  /**
+   * \brief Run the behaviors of the objects after the events.
+   */
+  void StepPostEvents(RuntimeScene& scene,
+                      const std::vector<RuntimeObject*>& objects);
+
+  /**
+   * \brief Return the number of types of behaviors found the last time the
+   * behaviors were run in BehaviorsTypesOrder.
+   */
+  std::size_t GetBehaviorsTypesCount() const { return batches.size(); }
+
+ private:
+  struct Batch {
+    Batch(const std::type_info& type_, bool parallel_)
+        : type(&type_), parallel(parallel_){};
+
+    const std::type_info* type;  ///< The type of the behaviors.
+    bool parallel;  ///< true if the behaviors can be run in parallel.
+    std::vector<gd::Behavior*> behaviors;
+  };
+
+  /**
+   * \brief Run the behaviors of each batch, using the threads for those that
+   * can be run in parallel.
+   */
+  void StepBatches(RuntimeScene& scene, bool preEvents);
+
+  /**
+   * \brief Group the behaviors of the objects by type.
+   */
+  void UpdateBatches(const std::vector<RuntimeObject*>& objects);
+
+  Order order;
+  std::unique_ptr<ThreadPool> threadPool;  ///< NULL if there is only the main
+                                           ///< thread.
+  std::vector<Batch> batches;  ///< The behaviors of each type, kept between
+                               ///< frames to reuse their memory.
+};
+
+#endif  // GDCPP_BEHAVIORSSCHEDULER_H
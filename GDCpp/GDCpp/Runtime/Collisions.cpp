@@ -28,6 +28,11 @@ bool PixelPerfectTest(const sf::Sprite& object1,
     // as they print to the error console which is slow, and then return black
     // which registers as a hit.
 
+    // The images can be atlases: the pixels of the sprites are in their
+    // texture rectangles.
+    const sf::IntRect& rect1 = object1.getTextureRect();
+    const sf::IntRect& rect2 = object2.getTextureRect();
+
     sf::Vector2f o1v;
     sf::Vector2f o2v;
     // Loop through our pixels
@@ -43,17 +48,17 @@ bool PixelPerfectTest(const sf::Sprite& object1,
 
         // Hack to make sure pixels fall within the Sprite's Image
         if (o1v.x > 0 && o1v.y > 0 && o2v.x > 0 && o2v.y > 0 &&
-            o1v.x < object1CollisionMask.getSize().x &&
-            o1v.y < object1CollisionMask.getSize().y &&
-            o2v.x < object2CollisionMask.getSize().x &&
-            o2v.y < object2CollisionMask.getSize().y) {
+            o1v.x < rect1.width && o1v.y < rect1.height &&
+            o2v.x < rect2.width && o2v.y < rect2.height) {
           // If both sprites have opaque pixels at the same point we've got a
           // hit
           if ((object1CollisionMask
-                   .getPixel(static_cast<int>(o1v.x), static_cast<int>(o1v.y))
+                   .getPixel(rect1.left + static_cast<int>(o1v.x),
+                             rect1.top + static_cast<int>(o1v.y))
                    .a > AlphaLimit) &&
               (object2CollisionMask
-                   .getPixel(static_cast<int>(o2v.x), static_cast<int>(o2v.y))
+                   .getPixel(rect2.left + static_cast<int>(o2v.x),
+                             rect2.top + static_cast<int>(o2v.y))
                    .a > AlphaLimit)) {
             return true;
           }
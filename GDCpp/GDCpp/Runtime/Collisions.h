@@ -9,7 +9,9 @@
 
 /**
  * \brief Pixel perfect collision test between two sprite objects
- * Alpha transparency, rotation and zooms are taken into account.
+ * Alpha transparency, rotation and zooms are taken into account. The pixels of
+ * sprites displaying a part of an image (like a texture atlas) are read in
+ * this part.
  *
  * \return true if the sprite are overlapping
  *
@@ -5,32 +5,57 @@
 #include <string.h>
 #include <fstream>
 #include <iostream>
+#include <algorithm>
+#include <cstdint>
 #include "GDCpp/Runtime/Tools/FileStream.h"
+#include "GDCpp/Runtime/Tools/LZ4.h"
+#if defined(WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
-DatFile::DatFile(void) { m_buffer = NULL; }
+DatFile::DatFile(void)
+    : m_data(NULL),
+      m_dataSize(0),
+      m_fileHandle(NULL),
+      m_mappingHandle(NULL) {
+  memset(&m_header, 0, sizeof(m_header));
+}
+
+DatFile::~DatFile(void) { Close(); }
+
+const std::size_t DatFile::BlockSize;
 
-DatFile::~DatFile(void) {
-  if (m_buffer != NULL) delete[] m_buffer;
+namespace {
+const std::uint32_t StoredBlockFlag =
+    0x80000000u;  ///< Set on the size of blocks stored without compression.
 }
+
 bool DatFile::Create(std::vector<gd::String> files,
                      gd::String directory,
-                     gd::String destination) {
+                     gd::String destination,
+                     bool compress) {
   // An file entry in order to push it in the object's std::vector
   sFileEntry entry;
   // An input file stream to read each file included
   gd::FileStream file;
   // An output file stream to write our DAT file
   gd::FileStream datfile;
-  // The buffer used to read/write the DAT file
-  char buffer[1];
+
+  Close();
 
   // DATHeader
   // We start by filling it with 0
   memset(&m_header, 0, sizeof(m_header));
   // Then we copy the ID
   memcpy(m_header.uniqueID, "EXEGD", 5);  // EXEcutable GDevelop
-  // Then the version
-  memcpy(m_header.version, "0.1", 3);
+  // Then the version: files are split in blocks, which can be compressed,
+  // since the version 0.2
+  memcpy(m_header.version, compress ? "0.2" : "0.1", 3);
   // Then the number of files to include
   m_header.nb_files = files.size();
 
@@ -61,142 +86,453 @@ bool DatFile::Create(std::vector<gd::String> files,
     }
   }
 
-  // Now, we know everything about our files, we can update offsets
-  long actual_offset = 0;
-  actual_offset += sizeof(sDATHeader);
-  actual_offset += m_header.nb_files * sizeof(sFileEntry);
-  for (std::size_t i = 0; i < m_entries.size(); i++) {
-    m_entries[i].offset = actual_offset;
-    actual_offset += m_entries[i].size;
-  }
-
-  // And finally, we are writing the DAT file
+  // And now, we are writing the DAT file
   datfile.open(destination, std::ios_base::out | std::ios_base::binary);
+  if (!datfile.is_open()) return false;
 
   // First, we write the header
   datfile.write((char*)&m_header, sizeof(sDATHeader));
 
-  // Then, the File Entries Table
+  // Then, the File Entries Table, which is written again once the offsets
+  // of the files are known
   for (std::size_t i = 0; i < m_entries.size(); i++) {
     datfile.write((char*)&m_entries[i], sizeof(sFileEntry));
   }
 
-  // Finally, we write each file
+  // Then, we write each file
   for (std::size_t i = 0; i < m_entries.size(); i++) {
+    m_entries[i].offset = datfile.tellp();
+
     gd::String fileToOpen = directory + "/" + files[i];
     file.open(fileToOpen, std::ios_base::in | std::ios_base::binary);
-    if (file.is_open()) {
-      file.seekg(0, std::ios::beg);
-      datfile << file.rdbuf();
-      file.close();
+    if (!file.is_open() ||
+        !WriteFile(file, m_entries[i].size, datfile, compress)) {
+      std::cout << "File " << files[i] << " can't be written." << std::endl;
+      return false;
     }
+    file.close();
+  }
+
+  // Finally, we update the File Entries Table
+  datfile.seekp(sizeof(sDATHeader), std::ios::beg);
+  for (std::size_t i = 0; i < m_entries.size(); i++) {
+    datfile.write((char*)&m_entries[i], sizeof(sFileEntry));
   }
+
   // And it's finished
+  bool success = datfile.good();
   datfile.close();
+  return success;
+}
+
+/**
+ * Write the content of a file in the DAT file. When compressing, the file is
+ * written as a table of the sizes of its blocks, followed by the blocks.
+ */
+bool DatFile::WriteFile(gd::FileStream& file,
+                        long size,
+                        gd::FileStream& datfile,
+                        bool compress) {
+  std::vector<char> block(BlockSize);
+  if (!compress) {
+    for (long written = 0; written < size;) {
+      std::size_t length = std::min<std::size_t>(size - written, BlockSize);
+      file.read(block.data(), length);
+      datfile.write(block.data(), length);
+      written += length;
+    }
+
+    return file.good() && datfile.good();
+  }
+
+  std::uint32_t blocksCount = (size + BlockSize - 1) / BlockSize;
+  std::vector<std::uint32_t> blocksSizes(blocksCount, 0);
+  std::streampos tablePosition = datfile.tellp();
+  datfile.write((char*)&blocksCount, sizeof(blocksCount));
+  datfile.write((char*)blocksSizes.data(),
+                blocksCount * sizeof(std::uint32_t));
+
+  std::vector<char> compressed(gd::LZ4::GetMaxCompressedSize(BlockSize));
+  for (std::uint32_t i = 0; i < blocksCount; ++i) {
+    std::size_t length = std::min<std::size_t>(size - i * BlockSize, BlockSize);
+    file.read(block.data(), length);
+
+    // Keep the blocks that barely compress as they are (images or sounds are
+    // usually already compressed), so that they are faster to read.
+    std::size_t compressedLength = gd::LZ4::Compress(
+        block.data(), length, compressed.data(), compressed.size());
+    if (compressedLength > 0 && compressedLength < length - length / 16) {
+      datfile.write(compressed.data(), compressedLength);
+      blocksSizes[i] = compressedLength;
+    } else {
+      datfile.write(block.data(), length);
+      blocksSizes[i] = length | StoredBlockFlag;
+    }
+  }
+
+  std::streampos end = datfile.tellp();
+  datfile.seekp(tablePosition + std::streamoff(sizeof(blocksCount)));
+  datfile.write((char*)blocksSizes.data(),
+                blocksCount * sizeof(std::uint32_t));
+  datfile.seekp(end);
+
+  return file.good() && datfile.good();
+}
+
+/**
+ * Map the whole file in memory (or read it entirely if it can't be mapped).
+ */
+bool DatFile::Map(const gd::String& source) {
+#if defined(WINDOWS)
+  HANDLE file = CreateFileW(source.ToWide().c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            NULL,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL,
+                            NULL);
+  if (file != INVALID_HANDLE_VALUE) {
+    LARGE_INTEGER size;
+    HANDLE mapping = NULL;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+      mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    const void* view =
+        mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (view) {
+      m_fileHandle = file;
+      m_mappingHandle = mapping;
+      m_data = static_cast<const char*>(view);
+      m_dataSize = static_cast<std::size_t>(size.QuadPart);
+      return true;
+    }
+
+    if (mapping) CloseHandle(mapping);
+    CloseHandle(file);
+  }
+#else
+  int file = open(source.ToLocale().c_str(), O_RDONLY);
+  if (file != -1) {
+    struct stat fileInfo;
+    void* view = MAP_FAILED;
+    if (fstat(file, &fileInfo) == 0 && fileInfo.st_size > 0)
+      view = mmap(NULL, fileInfo.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+    // The mapping stays valid after the file is closed.
+    close(file);
+    if (view != MAP_FAILED) {
+      m_data = static_cast<const char*>(view);
+      m_dataSize = static_cast<std::size_t>(fileInfo.st_size);
+      return true;
+    }
+  }
+#endif
+
+  // Fallback to a copy of the whole file in memory.
+  gd::FileStream datfile;
+  datfile.open(source, std::ios_base::in | std::ios_base::binary);
+  if (!datfile.is_open()) return false;
+
+  datfile.seekg(0, std::ios::end);
+  std::streamoff size = datfile.tellg();
+  if (size <= 0) return false;
+
+  m_buffer.resize(static_cast<std::size_t>(size));
+  datfile.seekg(0, std::ios::beg);
+  datfile.read(m_buffer.data(), size);
+  if (!datfile) {
+    m_buffer.clear();
+    return false;
+  }
+
+  m_data = m_buffer.data();
+  m_dataSize = m_buffer.size();
   return true;
 }
 
+void DatFile::Close() {
+  if (m_data != NULL && m_buffer.empty()) {
+#if defined(WINDOWS)
+    UnmapViewOfFile(m_data);
+    CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    CloseHandle(static_cast<HANDLE>(m_fileHandle));
+#else
+    munmap(const_cast<char*>(m_data), m_dataSize);
+#endif
+  }
+
+  m_data = NULL;
+  m_dataSize = 0;
+  m_fileHandle = NULL;
+  m_mappingHandle = NULL;
+  std::vector<char>().swap(m_buffer);
+  m_entries.clear();
+  m_entriesData.clear();
+  m_blocks.clear();
+  m_index.clear();
+  m_decompressedFiles.clear();
+  memset(&m_header, 0, sizeof(m_header));
+  m_datfile.clear();
+}
+
 /**
  * Load the DatFile from a file. Return true on success
  */
 bool DatFile::Read(gd::String source) {
-  bool success = false;
+  Close();
+  if (!Map(source)) return false;
 
-  // The input file stream from which we want informations
-  gd::FileStream datfile;
-  // A file entry in order to push it in the object's std::vector
-  sFileEntry entry;
+  // Check that the header and the entries table are inside the file.
+  if (m_dataSize < sizeof(sDATHeader)) {
+    Close();
+    return false;
+  }
+  memcpy(&m_header, m_data, sizeof(sDATHeader));
+  if (m_header.nb_files >
+      (m_dataSize - sizeof(sDATHeader)) / sizeof(sFileEntry)) {
+    Close();
+    return false;
+  }
 
-  // Filling the header with 0
-  memset(&m_header, 0, sizeof(m_header));
-  // We open the DAT file to read it
-  datfile.open(source, std::ios_base::in | std::ios_base::binary);
-  if (datfile.is_open()) {
-    // Getting to the Header position
-    datfile.seekg(0, std::ios::beg);
-    // Reading the DAT Header
-    datfile.read((char*)&m_header, sizeof(sDATHeader));
-    // Next we are reading each file entry
-    for (std::size_t i = 0; i < m_header.nb_files; i++) {
-      // Reading a File Entry
-      datfile.read((char*)&entry, sizeof(sFileEntry));
-      // Pushing it in our std::vector
-      m_entries.push_back(entry);
+  // Read the entries and index them by name, ignoring the entries with a
+  // content outside of the file.
+  bool hasBlocks = memcmp(m_header.version, "0.2", 3) == 0;
+  m_entries.resize(m_header.nb_files);
+  m_entriesData.resize(m_header.nb_files);
+  m_index.reserve(m_header.nb_files);
+  for (std::size_t i = 0; i < m_header.nb_files; i++) {
+    sFileEntry& entry = m_entries[i];
+    memcpy(&entry,
+           m_data + sizeof(sDATHeader) + i * sizeof(sFileEntry),
+           sizeof(sFileEntry));
+    entry.name[sizeof(entry.name) - 1] = '\0';
+
+    bool valid = entry.offset >= 0 && entry.size >= 0 &&
+                 static_cast<std::size_t>(entry.offset) <= m_dataSize;
+    if (valid && hasBlocks) {
+      valid = ReadBlocks(i);
+    } else if (valid) {
+      valid = static_cast<std::size_t>(entry.size) <=
+              m_dataSize - static_cast<std::size_t>(entry.offset);
+      m_entriesData[i].data = m_data + entry.offset;
+      m_entriesData[i].firstBlock = 0;
+      m_entriesData[i].blocksCount = 0;
+    }
+
+    if (!valid) {
+      cout << "Ignoring the invalid entry " << entry.name << " of " << source
+           << endl;
+      continue;
     }
-    // Since all seems ok, we keep the DAT file name
-    m_datfile = source;
-    success = true;
+
+    // Keep the first entry when there are duplicates, like the linear search
+    // used to do.
+    m_index.insert(std::make_pair(gd::String(entry.name), i));
   }
-  // Closing the DAT file
-  datfile.close();
-  return success;
+
+  m_datfile = source;
+  return true;
+}
+
+/**
+ * Read the table of the blocks of an entry, in a DAT file of version 0.2.
+ * Return false if the entry is invalid.
+ */
+bool DatFile::ReadBlocks(std::size_t entryIndex) {
+  const sFileEntry& entry = m_entries[entryIndex];
+  std::size_t offset = entry.offset;
+
+  std::uint32_t blocksCount;
+  if (m_dataSize - offset < sizeof(blocksCount)) return false;
+  memcpy(&blocksCount, m_data + offset, sizeof(blocksCount));
+  offset += sizeof(blocksCount);
+  if (blocksCount != (entry.size + BlockSize - 1) / BlockSize ||
+      blocksCount > (m_dataSize - offset) / sizeof(std::uint32_t))
+    return false;
+
+  const char* blocksTable = m_data + offset;
+  offset += blocksCount * sizeof(std::uint32_t);
+
+  std::vector<BlockData> blocks(blocksCount);
+  std::size_t blocksSize = 0;
+  bool compressed = false;
+  for (std::size_t i = 0; i < blocksCount; ++i) {
+    std::uint32_t storedSize;
+    memcpy(&storedSize,
+           blocksTable + i * sizeof(std::uint32_t),
+           sizeof(std::uint32_t));
+
+    BlockData& block = blocks[i];
+    block.offset = blocksSize;
+    block.size = storedSize & ~StoredBlockFlag;
+    block.compressed = (storedSize & StoredBlockFlag) == 0;
+    if (!block.compressed &&
+        block.size != std::min<std::size_t>(entry.size - i * BlockSize,
+                                            BlockSize))
+      return false;
+
+    blocksSize += block.size;
+    compressed = compressed || block.compressed;
+  }
+  if (blocksSize > m_dataSize - offset) return false;
+
+  // Files without compressed blocks are read as is, like in version 0.1.
+  EntryData& entryData = m_entriesData[entryIndex];
+  entryData.data = m_data + offset;
+  entryData.firstBlock = m_blocks.size();
+  entryData.blocksCount = compressed ? blocksCount : 0;
+  if (compressed) m_blocks.insert(m_blocks.end(), blocks.begin(), blocks.end());
+
+  return true;
+}
+
+/**
+ * Return the index of the entry of the file, or the number of entries if the
+ * file is not in the DAT file.
+ */
+std::size_t DatFile::GetEntryIndex(const gd::String& filename) const {
+  auto it = m_index.find(filename);
+  return it != m_index.end() ? it->second : m_entries.size();
+}
+
+bool DatFile::DecompressBlock(std::size_t entryIndex,
+                              std::size_t block,
+                              char* destination) const {
+  const EntryData& entryData = m_entriesData[entryIndex];
+  const BlockData& blockData = m_blocks[entryData.firstBlock + block];
+  std::size_t length = std::min<std::size_t>(
+      m_entries[entryIndex].size - block * BlockSize, BlockSize);
+
+  const char* source = entryData.data + blockData.offset;
+  if (!blockData.compressed) {
+    memcpy(destination, source, length);
+    return true;
+  }
+
+  return gd::LZ4::Decompress(source, blockData.size, destination, length);
 }
 
 ////////////////////////////////////////////////////////////
 /// Check if the DatFile contains a file
 ////////////////////////////////////////////////////////////
-bool DatFile::ContainsFile(const gd::String& filename) {
-  if (m_header.nb_files != m_entries.size()) return false;
+bool DatFile::ContainsFile(const gd::String& filename) const {
+  return GetEntryIndex(filename) != m_entries.size();
+}
 
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    if (gd::String(m_entries[i].name) == filename) return true;
+bool DatFile::IsCompressed(const gd::String& filename) const {
+  std::size_t entryIndex = GetEntryIndex(filename);
+  return entryIndex != m_entries.size() &&
+         m_entriesData[entryIndex].blocksCount != 0;
+}
+
+const char* DatFile::GetFile(const gd::String& filename) const {
+  std::size_t entryIndex = GetEntryIndex(filename);
+  if (entryIndex == m_entries.size()) return NULL;
+
+  const EntryData& entryData = m_entriesData[entryIndex];
+  if (entryData.blocksCount == 0) return entryData.data;
+
+  std::lock_guard<std::mutex> lock(m_decompressedFilesMutex);
+  auto it = m_decompressedFiles.find(entryIndex);
+  if (it != m_decompressedFiles.end()) {
+    it->second.usesCount++;
+    return it->second.content.data();
+  }
+
+  DecompressedFile file;
+  file.content.resize(m_entries[entryIndex].size);
+  file.usesCount = 1;
+  for (std::size_t i = 0; i < entryData.blocksCount; ++i) {
+    if (!DecompressBlock(entryIndex, i, file.content.data() + i * BlockSize)) {
+      cout << "Unable to decompress " << filename << endl;
+      return NULL;
+    }
   }
 
-  return false;
+  return m_decompressedFiles.emplace(entryIndex, std::move(file))
+      .first->second.content.data();
 }
 
-char* DatFile::GetFile(gd::String filename) {
-  // The input file stream from which we want information
-  gd::FileStream datfile;
+long int DatFile::GetFileSize(const gd::String& filename) const {
+  std::size_t entryIndex = GetEntryIndex(filename);
+  return entryIndex != m_entries.size() ? m_entries[entryIndex].size : 0;
+}
 
-  // Cleaning properly an ancient file loaded
-  if (m_buffer != NULL) {
-    delete[] m_buffer;
-    m_buffer = NULL;
-  }
+void DatFile::ReleaseFile(const gd::String& filename) {
+  std::size_t entryIndex = GetEntryIndex(filename);
 
-  // First, we have to find the file needed
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    // If we found it
-    if (gd::String(m_entries[i].name) == filename) {
-      // We are allocating memory to the buffer
-      m_buffer = new char[(m_entries[i].size)];
-      // Simple error catch
-      if (m_buffer == NULL) {
-        cout << "Unable to allocate a buffer of length " << (m_entries[i].size)
-             << " when loading " << filename << endl;
-        return (NULL);
-      }
+  std::lock_guard<std::mutex> lock(m_decompressedFilesMutex);
+  auto it = m_decompressedFiles.find(entryIndex);
+  if (it != m_decompressedFiles.end() && --it->second.usesCount == 0)
+    m_decompressedFiles.erase(it);
+}
+
+DatFileStream::DatFileStream()
+    : m_datFile(NULL),
+      m_entry(0),
+      m_position(0),
+      m_size(0),
+      m_loadedBlock(0) {}
 
-      // Opening the DAT file ot read the file datas needed
-      datfile.open(m_datfile, std::ios_base::in | std::ios_base::binary);
-      if (datfile.is_open()) {
-        // Going to the right position
-        datfile.seekg(m_entries[i].offset, std::ios::beg);
-        // Reading
-        datfile.read(m_buffer, m_entries[i].size);
-        // We can close the DAT file
-        datfile.close();
-        // Returning the buffer
-        cout << "Successfully loaded " << filename << endl;
-        return (m_buffer);
+bool DatFileStream::open(const DatFile& datFile, const gd::String& filename) {
+  std::size_t entryIndex = datFile.GetEntryIndex(filename);
+  if (entryIndex == datFile.m_entries.size()) return false;
+
+  m_datFile = &datFile;
+  m_entry = entryIndex;
+  m_position = 0;
+  m_size = datFile.m_entries[entryIndex].size;
+  m_block.clear();
+  return true;
+}
+
+sf::Int64 DatFileStream::read(void* data, sf::Int64 size) {
+  if (!m_datFile || size < 0) return -1;
+
+  char* output = static_cast<char*>(data);
+  std::size_t count =
+      std::min<std::size_t>(static_cast<std::size_t>(size), m_size - m_position);
+  const DatFile::EntryData& entryData = m_datFile->m_entriesData[m_entry];
+  if (entryData.blocksCount == 0) {
+    memcpy(output, entryData.data + m_position, count);
+    m_position += count;
+    return count;
+  }
+
+  // Decompress the blocks one by one, keeping the last one for the next reads.
+  std::size_t readCount = 0;
+  while (readCount < count) {
+    std::size_t block = m_position / DatFile::BlockSize;
+    if (m_block.empty() || m_loadedBlock != block) {
+      m_block.resize(DatFile::BlockSize);
+      if (!m_datFile->DecompressBlock(m_entry, block, m_block.data())) {
+        m_block.clear();
+        return -1;
       }
-      cout << "Unable to open file " << m_datfile << " when loading "
-           << filename << endl;
+      m_loadedBlock = block;
     }
+
+    std::size_t blockEnd =
+        std::min<std::size_t>((block + 1) * DatFile::BlockSize, m_size);
+    std::size_t length = std::min(count - readCount, blockEnd - m_position);
+    memcpy(output + readCount,
+           m_block.data() + m_position - block * DatFile::BlockSize,
+           length);
+    readCount += length;
+    m_position += length;
   }
-  // Finally, there is no such file in our DAT file
-  return (NULL);
+
+  return readCount;
 }
 
-long int DatFile::GetFileSize(gd::String filename) {
-  // First, we have to find the file needed
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    // If we found it
-    if (gd::String(m_entries[i].name) == filename) {
-      // Returning the size of the file found
-      return (m_entries[i].size);
-    }
-  }
-  return (0);
+sf::Int64 DatFileStream::seek(sf::Int64 position) {
+  if (!m_datFile) return -1;
+
+  m_position = std::min<std::size_t>(
+      static_cast<std::size_t>(std::max<sf::Int64>(position, 0)), m_size);
+  return m_position;
 }
+
+sf::Int64 DatFileStream::tell() { return m_datFile ? m_position : -1; }
+
+sf::Int64 DatFileStream::getSize() { return m_datFile ? m_size : -1; }
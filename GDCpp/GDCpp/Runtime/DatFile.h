@@ -8,9 +8,15 @@
 #ifndef DATFILE_H
 #define DATFILE_H
 
+#include <SFML/System/InputStream.hpp>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "GDCpp/Runtime/String.h"
+namespace gd {
+class FileStream;
+}
 
 using namespace std;
 
@@ -40,24 +46,153 @@ struct sFileEntry {
 /**
  * \brief Internal class used to create and access "DAT files".
  *
+ * When read, the DAT file is mapped in memory once and an index of its entries
+ * is built, so that files can be accessed without being copied.
+ *
+ * Files can be compressed when the DAT file is created: they are then split in
+ * blocks of BlockSize bytes compressed with LZ4, so that they can be
+ * decompressed progressively using a DatFileStream.
+ *
  * \ingroup ResourcesManagement
  */
 class GD_API DatFile {
  private:
+  /**
+   * \brief The location of the content of an entry.
+   */
+  struct EntryData {
+    const char* data;         ///< The start of the content (or of the blocks).
+    std::size_t firstBlock;   ///< The index of the first block, in m_blocks.
+    std::size_t blocksCount;  ///< The number of blocks (0 if not compressed).
+  };
+
+  /**
+   * \brief A block of a compressed file.
+   */
+  struct BlockData {
+    std::size_t offset;  ///< The offset of the block, from the entry data.
+    std::size_t size;    ///< The size of the (compressed) block.
+    bool compressed;     ///< false if the block is stored as is.
+  };
+
   gd::String m_datfile;               /// name of the DAT file
   sDATHeader m_header;                /// file header
   std::vector<sFileEntry> m_entries;  /// vector of files entries
-  char* m_buffer;                     /// Buffer pointing on a file in memory
+  std::vector<EntryData> m_entriesData;  /// Content of the entries
+  std::vector<BlockData> m_blocks;       /// Blocks of the compressed entries
+  std::unordered_map<gd::String, std::size_t>
+      m_index;                 /// Index of the entries, by file name
+  const char* m_data;          /// The content of the DAT file, in memory
+  std::size_t m_dataSize;      /// The size of the DAT file
+  std::vector<char> m_buffer;  /// The DAT file content, when it can't be mapped
+  void* m_fileHandle;          /// Handle to the mapped file (Windows only)
+  void* m_mappingHandle;       /// Handle to the mapping (Windows only)
+
+  struct DecompressedFile {
+    std::vector<char> content;
+    std::size_t usesCount;  /// Number of GetFile not yet released
+  };
+  mutable std::unordered_map<std::size_t, DecompressedFile>
+      m_decompressedFiles;  /// Decompressed content of compressed entries
+  mutable std::mutex m_decompressedFilesMutex;
+
+  bool Map(const gd::String& source);
+  void Close();
+  bool ReadBlocks(std::size_t entryIndex);
+  std::size_t GetEntryIndex(const gd::String& filename) const;
+  bool DecompressBlock(std::size_t entryIndex,
+                       std::size_t block,
+                       char* destination) const;
+
+  static bool WriteFile(gd::FileStream& file,
+                        long size,
+                        gd::FileStream& datfile,
+                        bool compress);
+
+  friend class DatFileStream;
+
  public:
   DatFile(void);
   ~DatFile(void);
+  DatFile(const DatFile&) = delete;
+  DatFile& operator=(const DatFile&) = delete;
+
+  /**
+   * \brief Create a DAT file containing the \a files, which are in \a
+   * directory.
+   *
+   * \param compress true to compress the files.
+   */
   bool Create(std::vector<gd::String> files,
               gd::String directory,
-              gd::String destination);
-  bool ContainsFile(const gd::String& filename);
+              gd::String destination,
+              bool compress = false);
+  bool ContainsFile(const gd::String& filename) const;
   bool Read(gd::String source);
-  char* GetFile(gd::String filename);
-  long int GetFileSize(gd::String filename);
+
+  /**
+   * \brief Return true if the file is compressed in the DAT file.
+   */
+  bool IsCompressed(const gd::String& filename) const;
+
+  /**
+   * \brief Return a pointer to the content of the file, or NULL if the file
+   * is not in the DAT file.
+   *
+   * \note The content is not copied: it stays valid until the DAT file is
+   * destroyed or another DAT file is read. Compressed files are decompressed
+   * in memory, which is kept until ReleaseFile is called as many times as
+   * GetFile (the file can be used by several threads at once).
+   */
+  const char* GetFile(const gd::String& filename) const;
+  long int GetFileSize(const gd::String& filename) const;
+
+  /**
+   * \brief Release the content of the file returned by GetFile. The memory
+   * used by the decompressed content is freed once all the calls to GetFile
+   * for this file were released.
+   *
+   * \warning The pointer returned by the matching call to GetFile is no
+   * longer valid.
+   */
+  void ReleaseFile(const gd::String& filename);
+
+  static const std::size_t BlockSize =
+      64 * 1024;  ///< The size of the blocks compressed files are split into.
+};
+
+/**
+ * \brief A stream to read a file of a DatFile, decompressing it progressively
+ * if it is compressed (useful for SFML classes reading their data
+ * continuously, like sf::Music).
+ *
+ * \ingroup ResourcesManagement
+ */
+class GD_API DatFileStream : public sf::InputStream {
+ public:
+  DatFileStream();
+
+  /**
+   * \brief Open the file called \a filename in \a datFile.
+   * \note \a datFile must be kept alive as long as the stream is used.
+   */
+  bool open(const DatFile& datFile, const gd::String& filename);
+
+  virtual sf::Int64 read(void* data, sf::Int64 size);
+
+  virtual sf::Int64 seek(sf::Int64 position);
+
+  virtual sf::Int64 tell();
+
+  virtual sf::Int64 getSize();
+
+ private:
+  const DatFile* m_datFile;
+  std::size_t m_entry;
+  std::size_t m_position;
+  std::size_t m_size;
+  std::vector<char> m_block;  ///< The last decompressed block.
+  std::size_t m_loadedBlock;  ///< The index of the last decompressed block.
 };
 
 #endif  // DATFILE_H
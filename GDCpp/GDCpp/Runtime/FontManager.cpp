@@ -11,6 +11,7 @@ FontManager *FontManager::_singleton = NULL;
 FontManager::~FontManager() { UnloadAllFonts(); }
 
 void FontManager::UnloadAllFonts() {
+  std::lock_guard<std::mutex> lock(mutex);
   // Need to explicit delete fonts...
   for (auto it = fonts.begin(); it != fonts.end(); ++it) {
     if ((*it).second) delete (*it).second;
@@ -41,6 +42,7 @@ void FontManager::EnsureDefaultFontIsLoaded() {
 }
 
 const sf::Font *FontManager::GetFont(const gd::String &fontName) {
+  std::lock_guard<std::mutex> lock(mutex);
   // Use default font if no font is specified
   if (fontName.empty()) {
     EnsureDefaultFontIsLoaded();
@@ -6,6 +6,7 @@
 #ifndef FONTMANAGER_H
 #define FONTMANAGER_H
 #include <SFML/Graphics.hpp>
+#include <mutex>
 #include <string>
 #include <vector>
 #include "GDCpp/Runtime/ResourcesLoader.h"
@@ -59,6 +60,8 @@ class GD_API FontManager {
       fontsBuffer;        ///< The buffer associated to each font, if any.
   sf::Font* defaultFont;  ///< The default font used when no font is specified.
                           ///< Initialized at first use.
+  std::mutex mutex;  ///< Protect the fonts, as scenes can be loaded by another
+                     ///< thread (see SceneStack::Preload).
 
   FontManager() : defaultFont(NULL){};
   virtual ~FontManager();
@@ -34,6 +34,17 @@ bool Music::OpenFromMemory(std::size_t size) {
   return true;
 }
 
+bool Music::OpenFromStream(sf::InputStream* newStream) {
+  music.stop();
+  stream.reset(newStream);
+  if (!stream) {
+    cout << "Tried to open a music from a NULL stream";
+    return false;
+  }
+
+  return music.openFromStream(*stream);
+}
+
 void Music::Play() { music.play(); }
 
 void Music::Pause() { music.pause(); }
@@ -6,6 +6,7 @@
 #ifndef MUSIC_H
 #define MUSIC_H
 #include <SFML/Audio.hpp>
+#include <memory>
 #include <string>
 #include "GDCpp/Runtime/String.h"
 
@@ -45,6 +46,17 @@ class GD_API Music {
    */
   bool OpenFromMemory(std::size_t size);
 
+  /**
+   * \brief Open the music from a stream, which is read progressively while the
+   * music is played.
+   *
+   * \param newStream The stream, which is owned (and deleted) by the music.
+   */
+  bool OpenFromStream(sf::InputStream* newStream);
+
+  std::unique_ptr<sf::InputStream> stream;  ///< The stream the music is read
+                                            ///< from, if any. Declared before
+                                            ///< music to be destroyed after it.
   sf::Music music;  ///< SFML Music
   char* buffer;     ///< Music buffer when music have been loaded from memory
 
@@ -5,12 +5,48 @@
  */
 #include "GDCpp/Runtime/ObjInstancesHolder.h"
 #include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeObjectsPool.h"
 #include "GDCpp/Runtime/profile.h"
 
+std::atomic<std::size_t> ObjInstancesHolder::lastSlotsId(0);
+
+ObjInstancesHolder::ObjInstancesHolder()
+    : slotsId(++lastSlotsId), changesDeferred(false) {
+  GetObjectSlot("");  // Deleted objects slot.
+}
+
+std::size_t ObjInstancesHolder::GetObjectSlot(const gd::String& name) {
+  auto it = objectsSlots.find(name);
+  if (it != objectsSlots.end()) return it->second;
+
+  std::size_t slot = objectsInstances.size();
+  objectsSlots[name] = slot;
+  objectsInstances.push_back(RuntimeObjList());
+  objectsInstancesRefs.push_back(RuntimeObjNonOwningPtrList());
+
+  return slot;
+}
+
 RuntimeObject* ObjInstancesHolder::AddObject(RuntimeObjSPtr&& object) {
-  auto it = objectsInstances[object->GetName()].insert(
-      objectsInstances[object->GetName()].end(), std::move(object));
-  objectsInstancesRefs[(*it)->GetName()].push_back(it->get());
+  if (changesDeferred) {
+    std::lock_guard<std::mutex> lock(deferredChangesMutex);
+    deferredAddedObjects.push_back(std::move(object));
+    return deferredAddedObjects.back().get();
+  }
+
+  object->allObjectsIndex = allObjects.size();
+  allObjects.push_back(object.get());
+
+  return InsertInSlot(std::move(object));
+}
+
+RuntimeObject* ObjInstancesHolder::InsertInSlot(RuntimeObjSPtr&& object) {
+  std::size_t slot = GetObjectSlot(object->GetName());
+  object->instancesSlot = slot;
+  object->instancesIndex = objectsInstances[slot].size();
+  auto it = objectsInstances[slot].insert(objectsInstances[slot].end(),
+                                          std::move(object));
+  objectsInstancesRefs[slot].push_back(it->get());
 
 #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
   if (!debugger.expired()) debugger.lock()->OnRuntimeObjectAdded(it->get());
@@ -19,57 +55,103 @@ RuntimeObject* ObjInstancesHolder::AddObject(RuntimeObjSPtr&& object) {
   return it->get();
 }
 
-RuntimeObjNonOwningPtrList ObjInstancesHolder::GetObjectsRawPointers(
+const RuntimeObjNonOwningPtrList& ObjInstancesHolder::GetObjectsRawPointers(
     const gd::String& name) {
-  return objectsInstancesRefs[name];
+  return objectsInstancesRefs[GetObjectSlot(name)];
 }
 
-void ObjInstancesHolder::ObjectNameHasChanged(const RuntimeObject* object) {
-  std::unique_ptr<RuntimeObject> theObject;  // We need the object to keep
-                                             // alive.
-
-  // Find and erase the object from the object lists.
-  for (auto it = objectsInstances.begin(); it != objectsInstances.end(); ++it) {
-    RuntimeObjList& list = it->second;
-    for (std::size_t i = 0; i < list.size(); ++i) {
-      if (list[i].get() == object) {
+RuntimeObjSPtr ObjInstancesHolder::DetachObject(const RuntimeObject* object) {
+  RuntimeObjList& list = objectsInstances[object->instancesSlot];
+  RuntimeObjNonOwningPtrList& refsList =
+      objectsInstancesRefs[object->instancesSlot];
+  std::size_t index = object->instancesIndex;
+
+  // Swap the object with the last one of the lists, and pop it.
+  RuntimeObjSPtr theObject = std::move(list[index]);
+  if (index != list.size() - 1) {
+    list[index] = std::move(list.back());
+    refsList[index] = refsList.back();
+    list[index]->instancesIndex = index;
+  }
+  list.pop_back();
+  refsList.pop_back();
+
+  return theObject;
+}
+
+void ObjInstancesHolder::FlushDeletedObjects(RuntimeObjectsPool& pool) {
+  std::size_t slot = GetDeletedObjectsSlot();
 #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
-        if (!debugger.expired())
-          debugger.lock()->OnRuntimeObjectAboutToBeRemoved(list[i].get());
-#endif
-        theObject = std::move(list[i]);
-        list.erase(list.begin() + i);
-        break;
-      }
-    }
+  if (!debugger.expired()) {
+    for (auto& objectPtr : objectsInstances[slot])
+      debugger.lock()->OnRuntimeObjectAboutToBeRemoved(objectPtr.get());
   }
-  // Find and erase the object from the object raw pointers lists.
-  for (auto it = objectsInstancesRefs.begin(); it != objectsInstancesRefs.end();
-       ++it) {
-    RuntimeObjNonOwningPtrList& associatedList = it->second;
-    associatedList.erase(
-        std::remove(associatedList.begin(), associatedList.end(), object),
-        associatedList.end());
+#endif
+  for (RuntimeObject* object : objectsInstancesRefs[slot])
+    RemoveFromAllObjects(object);
+
+  for (auto& object : objectsInstances[slot]) pool.Recycle(std::move(object));
+  objectsInstances[slot].clear();
+  objectsInstancesRefs[slot].clear();
+}
+
+void ObjInstancesHolder::ObjectNameHasChanged(const RuntimeObject* object) {
+  if (changesDeferred) {
+    std::lock_guard<std::mutex> lock(deferredChangesMutex);
+    deferredRenamedObjects.push_back(object);
+    return;
   }
 
-  AddObject(std::move(theObject));
+  if (!Contains(object)) return;
+
+#if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
+  if (!debugger.expired())
+    debugger.lock()->OnRuntimeObjectAboutToBeRemoved(
+        const_cast<RuntimeObject*>(object));
+#endif
+
+  InsertInSlot(DetachObject(object));
+}
+
+void ObjInstancesHolder::ApplyDeferredChanges() {
+  changesDeferred = false;
+
+  // Objects are added first, as they can also have been renamed.
+  for (auto& object : deferredAddedObjects) AddObject(std::move(object));
+  for (const RuntimeObject* object : deferredRenamedObjects)
+    ObjectNameHasChanged(object);
+
+  deferredAddedObjects.clear();
+  deferredRenamedObjects.clear();
 }
 
 void ObjInstancesHolder::Init(const ObjInstancesHolder& other) {
   objectsInstances.clear();
   objectsInstancesRefs.clear();
+  allObjects.clear();
+  objectsSlots.clear();
+  slotsId = ++lastSlotsId;
+  changesDeferred = false;
+  deferredAddedObjects.clear();
+  deferredRenamedObjects.clear();
+  GetObjectSlot("");  // Deleted objects slot.
 
 #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
   debugger =
       std::weak_ptr<BaseDebugger>();  // Do not affect the other's debugger
 #endif
 
+  // Keep the same slots as the other container.
+  std::vector<const gd::String*> slotsNames(other.objectsInstances.size());
+  for (auto& it : other.objectsSlots) slotsNames[it.second] = &it.first;
+  for (const gd::String* name : slotsNames) GetObjectSlot(*name);
+
   for (auto it = other.objectsInstances.cbegin();
        it != other.objectsInstances.cend();
        ++it) {
-    for (std::size_t i = 0; i < it->second.size();
+    for (std::size_t i = 0; i < it->size();
          ++i)  // We need to really copy the objects
-      AddObject(std::unique_ptr<RuntimeObject>(it->second[i]->Clone()));
+      AddObject(std::unique_ptr<RuntimeObject>((*it)[i]->Clone()));
   }
 }
 
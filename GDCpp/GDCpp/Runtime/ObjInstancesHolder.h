@@ -2,8 +2,11 @@
 #define OBJINSTANCESHOLDER_H
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,6 +17,7 @@
 #endif
 
 class RuntimeObject;
+class RuntimeObjectsPool;
 
 using RuntimeObjList = std::vector<std::unique_ptr<RuntimeObject>>;
 using RuntimeObjNonOwningPtrList = std::vector<RuntimeObject*>;
@@ -23,6 +27,14 @@ using RuntimeObjSPtr = std::unique_ptr<RuntimeObject>;
 /**
  * \brief Contains lists of objects classified by the name of the objects.
  *
+ * Each name is associated to a slot, which can be used instead of the name to
+ * access the objects quickly (see GetObjectSlot).
+ *
+ * \note Objects are appended to their list, but removing (or renaming) an
+ * object moves the last object of its list to its position. The order of the
+ * objects, used by events like "For each object", thus changes after a
+ * deletion.
+ *
  * \see RuntimeScene
  * \ingroup GameEngine
  */
@@ -31,7 +43,7 @@ class GD_API ObjInstancesHolder {
   /**
    * \brief Default constructor
    */
-  ObjInstancesHolder(){};
+  ObjInstancesHolder();
 
   /**
    * \brief Copy constructor
@@ -56,37 +68,86 @@ class GD_API ObjInstancesHolder {
    */
   RuntimeObject* AddObject(RuntimeObjSPtr&& object);
 
+  /**
+   * \brief Get the slot associated to the objects with the specified name.
+   *
+   * Slots are integers identifying a list of objects in the container. They
+   * stay valid until the container is cleared or assigned, so they can be
+   * resolved once (usually when the scene is loaded) and then used to
+   * access the lists without hashing the name again.
+   *
+   * \note A new empty slot is created if the name was never used before.
+   */
+  std::size_t GetObjectSlot(const gd::String& name);
+
+  /**
+   * \brief Return the number of slots in the container.
+   */
+  inline std::size_t GetObjectSlotsCount() const {
+    return objectsInstances.size();
+  }
+
+  /**
+   * \brief Get a number that uniquely identifies this container and its
+   * slots.
+   *
+   * The identifier changes when the slots are invalidated (when the container
+   * is cleared or assigned). It is never 0.
+   */
+  inline std::size_t GetSlotsId() const { return slotsId; }
+
   /**
    * \brief Get all objects with the specified name
    */
   inline const RuntimeObjList& GetObjects(const gd::String& name) {
-    return objectsInstances[name];
+    return objectsInstances[GetObjectSlot(name)];
   }
 
   /**
-   * \brief Get a "raw pointers" list to objects with the specified name
+   * \brief Get all objects stored in the specified slot.
+   * \see GetObjectSlot
    */
-  RuntimeObjNonOwningPtrList GetObjectsRawPointers(const gd::String& name);
+  inline const RuntimeObjList& GetObjects(std::size_t slot) const {
+    return objectsInstances[slot];
+  }
 
   /**
-   * \brief Get a list of all objects contained.
+   * \brief Get a "raw pointers" list to objects with the specified name
    */
-  inline RuntimeObjNonOwningPtrList GetAllObjects() {
-    RuntimeObjNonOwningPtrList objList;
+  const RuntimeObjNonOwningPtrList& GetObjectsRawPointers(
+      const gd::String& name);
 
-    for (auto it = objectsInstances.begin(); it != objectsInstances.end();
-         ++it) {
-      for (auto it2 = it->second.begin(); it2 != it->second.end(); ++it2) {
-        objList.push_back(it2->get());
-      }
-    }
+  /**
+   * \brief Get a "raw pointers" list to objects stored in the specified slot.
+   * \note The reference stays valid until the container is cleared or
+   * assigned.
+   * \see GetObjectSlot
+   */
+  inline const RuntimeObjNonOwningPtrList& GetObjectsRawPointers(
+      std::size_t slot) const {
+    return objectsInstancesRefs[slot];
+  }
 
-    return objList;
+  /**
+   * \brief Get a list of all objects contained.
+   *
+   * The list is kept up to date when objects are added or removed, so getting
+   * it does not allocate anything.
+   *
+   * \note Objects added while iterating on the list are appended to it:
+   * store the size of the list before iterating if they must be skipped.
+   */
+  inline const RuntimeObjNonOwningPtrList& GetAllObjects() const {
+    return allObjects;
   }
 
   /**
    * \brief Remove an object
    *
+   * The object is found in constant time thanks to the position stored in it
+   * by the container. The last object of its list is moved to its position,
+   * so the order of the objects in a list is not preserved.
+   *
    * \warning During the game, do not directly remove an object using this
    * function, but make its name empty instead. Example: \code
    * myObject->SetName(""); //The scene will take care of deleting the object
@@ -94,55 +155,92 @@ class GD_API ObjInstancesHolder {
    * \endcode
    */
   inline void RemoveObject(RuntimeObject* object) {
+    if (!Contains(object)) return;
+
 #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
     if (!debugger.expired())
       debugger.lock()->OnRuntimeObjectAboutToBeRemoved(object);
 #endif
 
-    for (auto it = objectsInstances.begin(); it != objectsInstances.end();
-         ++it) {
-      RuntimeObjList& associatedList = it->second;
-      associatedList.erase(
-          std::remove_if(
-              associatedList.begin(),
-              associatedList.end(),
-              [&object](const std::unique_ptr<RuntimeObject>& objectPtr) {
-                return objectPtr.get() == object;
-              }),
-          associatedList.end());
-    }
-    for (auto it = objectsInstancesRefs.begin();
-         it != objectsInstancesRefs.end();
-         ++it) {
-      RuntimeObjNonOwningPtrList& associatedList = it->second;
-      associatedList.erase(
-          std::remove(associatedList.begin(), associatedList.end(), object),
-          associatedList.end());
-    }
+    RemoveFromAllObjects(object);
+    DetachObject(object);
   }
 
   /**
    * \brief Remove an entire list of object with a given name
    */
   inline void RemoveObjects(const gd::String& name) {
+    RemoveObjects(GetObjectSlot(name));
+  }
+
+  /**
+   * \brief Remove all the objects stored in the specified slot.
+   * \see GetObjectSlot
+   */
+  inline void RemoveObjects(std::size_t slot) {
 #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
     if (!debugger.expired()) {
-      for (auto& objectPtr : objectsInstances[name])
+      for (auto& objectPtr : objectsInstances[slot])
         debugger.lock()->OnRuntimeObjectAboutToBeRemoved(objectPtr.get());
     }
 #endif
-    objectsInstances[name].clear();
-    objectsInstancesRefs[name].clear();
+    for (RuntimeObject* object : objectsInstancesRefs[slot])
+      RemoveFromAllObjects(object);
+
+    objectsInstances[slot].clear();
+    objectsInstancesRefs[slot].clear();
   }
 
+  /**
+   * \brief Get the slot containing the objects deleted from the scene (i.e:
+   * the objects with an empty name).
+   */
+  inline std::size_t GetDeletedObjectsSlot() const { return 0; }
+
+  /**
+   * \brief Destroy all the objects deleted from the scene in a single pass.
+   *
+   * Objects deleted by the events (see RuntimeObject::DeleteFromScene) are
+   * moved to the deleted objects slot: the scene calls this once per frame,
+   * after the events, to destroy them all.
+   *
+   * \see GetDeletedObjectsSlot
+   */
+  inline void FlushDeletedObjects() { RemoveObjects(GetDeletedObjectsSlot()); }
+
+  /**
+   * \brief Remove all the objects deleted from the scene, giving them to \a
+   * pool so that they can be reused by the next objects created.
+   *
+   * \see FlushDeletedObjects
+   */
+  void FlushDeletedObjects(RuntimeObjectsPool& pool);
+
   /**
    * \brief To be called when an object has changed its name.
    */
   void ObjectNameHasChanged(const RuntimeObject* object);
 
+  /**
+   * \brief Defer the objects added and the changes of names (including the
+   * objects deleted from the scene) until ApplyDeferredChanges is called.
+   *
+   * While changes are deferred, AddObject and ObjectNameHasChanged can be
+   * called by several threads at once (for example by behaviors run in
+   * parallel, see BehaviorsScheduler).
+   */
+  void DeferChanges() { changesDeferred = true; }
+
+  /**
+   * \brief Add the objects and apply the changes of names deferred since
+   * DeferChanges was called.
+   */
+  void ApplyDeferredChanges();
+
   /**
    * \brief Clear the container.
-   * \note All objects contained inside are destroyed.
+   * \note All objects contained inside are destroyed and slots are
+   * invalidated.
    */
   inline void Clear() {
 #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
@@ -150,6 +248,10 @@ class GD_API ObjInstancesHolder {
 #endif
     objectsInstances.clear();
     objectsInstancesRefs.clear();
+    allObjects.clear();
+    objectsSlots.clear();
+    slotsId = ++lastSlotsId;
+    GetObjectSlot("");  // Deleted objects slot.
   }
 
 #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
@@ -162,11 +264,62 @@ class GD_API ObjInstancesHolder {
  private:
   void Init(const ObjInstancesHolder& other);
 
-  std::unordered_map<gd::String, RuntimeObjList>
-      objectsInstances;  ///< The list of all objects, classified by name
-  std::unordered_map<gd::String, RuntimeObjNonOwningPtrList>
+  /**
+   * \brief Return true if the object is stored in the container.
+   */
+  bool Contains(const RuntimeObject* object) const {
+    return object->instancesSlot < objectsInstancesRefs.size() &&
+           object->instancesIndex <
+               objectsInstancesRefs[object->instancesSlot].size() &&
+           objectsInstancesRefs[object->instancesSlot]
+                               [object->instancesIndex] == object;
+  }
+
+  /**
+   * \brief Remove the object from its list, in constant time, and return it.
+   * \warning The object must be stored in the container.
+   * \note The object is not removed from the list of all objects.
+   */
+  RuntimeObjSPtr DetachObject(const RuntimeObject* object);
+
+  /**
+   * \brief Store the object at the end of the list of its slot.
+   * \note The object is not added to the list of all objects.
+   */
+  RuntimeObject* InsertInSlot(RuntimeObjSPtr&& object);
+
+  /**
+   * \brief Remove the object from the list of all objects, in constant time.
+   */
+  void RemoveFromAllObjects(RuntimeObject* object) {
+    std::size_t index = object->allObjectsIndex;
+    if (index != allObjects.size() - 1) {
+      allObjects[index] = allObjects.back();
+      allObjects[index]->allObjectsIndex = index;
+    }
+    allObjects.pop_back();
+  }
+
+  std::unordered_map<gd::String, std::size_t>
+      objectsSlots;  ///< The slot associated to each object name.
+  std::deque<RuntimeObjList>
+      objectsInstances;  ///< The list of all objects, classified by slot. A
+                         ///< deque is used so that references to the lists
+                         ///< stay valid when new slots are added.
+  std::deque<RuntimeObjNonOwningPtrList>
       objectsInstancesRefs;  ///< Clones of the objectsInstances lists, but with
                              ///< references instead.
+  RuntimeObjNonOwningPtrList
+      allObjects;        ///< All the objects, whatever their slot.
+  std::size_t slotsId;  ///< Identify the current slots (see GetSlotsId).
+
+  bool changesDeferred;  ///< true if changes are deferred (see DeferChanges).
+  std::mutex deferredChangesMutex;
+  RuntimeObjList deferredAddedObjects;
+  std::vector<const RuntimeObject*> deferredRenamedObjects;
+
+  static std::atomic<std::size_t> lastSlotsId;  ///< Atomic as scenes can be
+                                                ///< loaded by another thread.
 
 #if defined(GD_IDE_ONLY) && !defined(GD_NO_WX_GUI)
   std::weak_ptr<BaseDebugger> debugger;
@@ -7,8 +7,17 @@
 #include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <limits>
 #include "GDCpp/Runtime/Polygon2d.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GD_POLYGON_COLLISION_SSE2
+static_assert(sizeof(sf::Vector2f) == 2 * sizeof(float),
+              "Vertices must be stored as contiguous x and y floats");
+#endif
+
 namespace {
 
 void normalise(sf::Vector2f& v) {
@@ -33,17 +42,52 @@ float crossProduct(const sf::Vector2f a, const sf::Vector2f b) {
   return cp;
 }
 
+/**
+ * Project the vertices of the polygon on the axis (which is not required to be
+ * normalized).
+ */
 void project(const sf::Vector2f axis,
              const Polygon2d& p,
              float& min,
              float& max) {
-  float dp = dotProduct(axis, p.vertices[0]);
+  const std::size_t count = p.vertices.size();
+  std::size_t i = 0;
+
+#if defined(GD_POLYGON_COLLISION_SSE2)
+  if (count >= 4) {
+    // Vertices are stored as [x0, y0, x1, y1, ...]: load them 4 by 4 and
+    // shuffle the products to get their x and y components in separate
+    // registers.
+    const float* coords = &p.vertices[0].x;
+    const __m128 axisXY = _mm_setr_ps(axis.x, axis.y, axis.x, axis.y);
+    __m128 minDots = _mm_set1_ps(FLT_MAX);
+    __m128 maxDots = _mm_set1_ps(-FLT_MAX);
+    for (; i + 4 <= count; i += 4) {
+      __m128 v01 = _mm_mul_ps(_mm_loadu_ps(coords + 2 * i), axisXY);
+      __m128 v23 = _mm_mul_ps(_mm_loadu_ps(coords + 2 * i + 4), axisXY);
+      __m128 dots = _mm_add_ps(_mm_shuffle_ps(v01, v23, _MM_SHUFFLE(2, 0, 2, 0)),
+                               _mm_shuffle_ps(v01, v23, _MM_SHUFFLE(3, 1, 3, 1)));
+      minDots = _mm_min_ps(minDots, dots);
+      maxDots = _mm_max_ps(maxDots, dots);
+    }
 
-  min = dp;
-  max = dp;
+    minDots = _mm_min_ps(minDots, _mm_movehl_ps(minDots, minDots));
+    minDots = _mm_min_ss(minDots, _mm_shuffle_ps(minDots, minDots, 1));
+    maxDots = _mm_max_ps(maxDots, _mm_movehl_ps(maxDots, maxDots));
+    maxDots = _mm_max_ss(maxDots, _mm_shuffle_ps(maxDots, maxDots, 1));
+    min = _mm_cvtss_f32(minDots);
+    max = _mm_cvtss_f32(maxDots);
+  } else
+#endif
+  {
+    float dp = dotProduct(axis, p.vertices[0]);
+    min = dp;
+    max = dp;
+    i = 1;
+  }
 
-  for (std::size_t i = 1; i < p.vertices.size(); i++) {
-    dp = dotProduct(axis, p.vertices[i]);
+  for (; i < count; i++) {
+    float dp = dotProduct(axis, p.vertices[i]);
 
     if (dp < min)
       min = dp;
@@ -52,6 +96,24 @@ void project(const sf::Vector2f axis,
   }
 }
 
+/**
+ * Compute the bounding box of the polygon.
+ */
+void getBoundingBox(const Polygon2d& p,
+                    float& minX,
+                    float& minY,
+                    float& maxX,
+                    float& maxY) {
+  minX = maxX = p.vertices[0].x;
+  minY = maxY = p.vertices[0].y;
+  for (std::size_t i = 1; i < p.vertices.size(); i++) {
+    minX = std::min(minX, p.vertices[i].x);
+    maxX = std::max(maxX, p.vertices[i].x);
+    minY = std::min(minY, p.vertices[i].y);
+    maxY = std::max(maxY, p.vertices[i].y);
+  }
+}
+
 float distance(float minA, float maxA, float minB, float maxB) {
   if (minA < minB)
     return minB - maxA;
@@ -61,8 +123,8 @@ float distance(float minA, float maxA, float minB, float maxB) {
 
 }  // namespace
 
-CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
-                                            Polygon2d& p2,
+CollisionResult GD_API PolygonCollisionTest(const Polygon2d& p1,
+                                            const Polygon2d& p2,
                                             bool ignoreTouchingEdges) {
   if (p1.vertices.size() < 3 || p2.vertices.size() < 3) {
     CollisionResult result;
@@ -72,29 +134,27 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
     return result;
   }
 
-  p1.ComputeEdges();
-  p2.ComputeEdges();
-
-  sf::Vector2f edge;
+  // Axes are not normalized: the sign of the distance between projections
+  // does not depend on the axis length, and the squared distance divided by
+  // the squared axis length is enough to find the minimum distance. Only the
+  // axis of the minimum distance is normalized, at the end.
   sf::Vector2f move_axis(0, 0);
-  sf::Vector2f mtd(0, 0);
-
-  float min_dist = FLT_MAX;
+  float min_dist = 0;
+  float min_sq_dist = std::numeric_limits<float>::infinity();
 
   CollisionResult result;
 
   // Iterate over all the edges composing the polygons
-  for (std::size_t i = 0; i < p1.vertices.size() + p2.vertices.size(); i++) {
-    if (i < p1.vertices.size())  // or <=
-    {
-      edge = p1.edges[i];
-    } else {
-      edge = p2.edges[i - p1.vertices.size()];
-    }
+  const std::size_t count1 = p1.vertices.size();
+  const std::size_t count2 = p2.vertices.size();
+  for (std::size_t i = 0; i < count1 + count2; i++) {
+    sf::Vector2f edge =
+        i < count1
+            ? p1.vertices[(i + 1) % count1] - p1.vertices[i]
+            : p2.vertices[(i - count1 + 1) % count2] - p2.vertices[i - count1];
 
     sf::Vector2f axis(
         -edge.y, edge.x);  // Get the axis to which polygons will be projected
-    normalise(axis);
 
     float minA = 0;
     float minB = 0;
@@ -115,16 +175,24 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
       return result;
     }
 
-    float absDist = std::abs(dist);
+    float sqAxisLength = dotProduct(axis, axis);
+    float sqDist = sqAxisLength != 0.0f ? dist * dist / sqAxisLength : 0.0f;
 
-    if (absDist < min_dist) {
-      min_dist = absDist;
+    if (sqDist < min_sq_dist) {
+      min_sq_dist = sqDist;
+      min_dist = sqAxisLength != 0.0f ? std::abs(dist) : 0.0f;
       move_axis = axis;
     }
   }
 
   result.collision = true;
 
+  float moveAxisLength = sqrt(dotProduct(move_axis, move_axis));
+  if (moveAxisLength != 0.0f) {
+    min_dist /= moveAxisLength;
+    normalise(move_axis);
+  }
+
   sf::Vector2f d = p1.ComputeCenter() - p2.ComputeCenter();
   if (dotProduct(d, move_axis) < 0.0f) move_axis = -move_axis;
   result.move_axis = move_axis * min_dist;
@@ -132,8 +200,36 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
   return result;
 }
 
+bool GD_API IsPolygonCollidingWithAny(const Polygon2d& polygon,
+                                      const std::vector<Polygon2d>& others,
+                                      bool ignoreTouchingEdges) {
+  if (polygon.vertices.size() < 3) return false;
+
+  float minX, minY, maxX, maxY;
+  getBoundingBox(polygon, minX, minY, maxX, maxY);
+
+  for (std::size_t i = 0; i < others.size(); ++i) {
+    const Polygon2d& other = others[i];
+    if (other.vertices.size() < 3) continue;
+
+    // Polygons with bounding boxes not overlapping can't be in collision.
+    float otherMinX, otherMinY, otherMaxX, otherMaxY;
+    getBoundingBox(other, otherMinX, otherMinY, otherMaxX, otherMaxY);
+    float distX = distance(minX, maxX, otherMinX, otherMaxX);
+    float distY = distance(minY, maxY, otherMinY, otherMaxY);
+    if (distX > 0.0f || distY > 0.0f ||
+        ((distX == 0.0f || distY == 0.0f) && ignoreTouchingEdges))
+      continue;
+
+    if (PolygonCollisionTest(polygon, other, ignoreTouchingEdges).collision)
+      return true;
+  }
+
+  return false;
+}
+
 RaycastResult GD_API PolygonRaycastTest(
-    Polygon2d& poly, float startX, float startY, float endX, float endY) {
+    const Polygon2d& poly, float startX, float startY, float endX, float endY) {
   RaycastResult result;
   result.collision = false;
 
@@ -141,7 +237,6 @@ RaycastResult GD_API PolygonRaycastTest(
     return result;
   }
 
-  poly.ComputeEdges();
   sf::Vector2f p, q, r, s;
   float minSqDist = FLT_MAX;
 
@@ -151,10 +246,11 @@ RaycastResult GD_API PolygonRaycastTest(
   r.x = endX - startX;
   r.y = endY - startY;
 
-  for (int i = 0; i < poly.edges.size(); i++) {
+  const std::size_t count = poly.vertices.size();
+  for (std::size_t i = 0; i < count; i++) {
     // Edge segment: q + u*s
     q = poly.vertices[i];
-    s = poly.edges[i];
+    s = poly.vertices[(i + 1) % count] - q;
     sf::Vector2f deltaQP = q - p;
     float crossRS = crossProduct(r, s);
     float t = crossProduct(deltaQP, s) / crossRS;
@@ -216,7 +312,7 @@ RaycastResult GD_API PolygonRaycastTest(
   return result;
 }
 
-bool GD_API IsPointInsidePolygon(Polygon2d& poly, float x, float y) {
+bool GD_API IsPointInsidePolygon(const Polygon2d& poly, float x, float y) {
   bool inside = false;
   sf::Vector2f vi, vj;
 
@@ -6,6 +6,7 @@
 #ifndef POLYGONCOLLISION_H
 #define POLYGONCOLLISION_H
 #include <SFML/System.hpp>
+#include <vector>
 class Polygon2d;
 
 /**
@@ -44,10 +45,26 @@ struct RaycastResult {
  *
  * \ingroup GameEngine
  */
-CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
-                                            Polygon2d& p2,
+CollisionResult GD_API PolygonCollisionTest(const Polygon2d& p1,
+                                            const Polygon2d& p2,
                                             bool ignoreTouchingEdges = false);
 
+/**
+ * Check if a polygon is colliding with at least one polygon of a list.
+ *
+ * The bounding box of the polygon is computed once, and polygons of the list
+ * with a bounding box not overlapping it are skipped without doing the full
+ * collision test.
+ *
+ * \return true if the polygon is overlapping at least one of the others
+ * \see PolygonCollisionTest
+ *
+ * \ingroup GameEngine
+ */
+bool GD_API IsPolygonCollidingWithAny(const Polygon2d& polygon,
+                                      const std::vector<Polygon2d>& others,
+                                      bool ignoreTouchingEdges = false);
+
 /**
  * Do a raycast test.
  * \warning Polygon must be convex.
@@ -59,7 +76,7 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
  * \ingroup GameEngine
  */
 RaycastResult GD_API PolygonRaycastTest(
-    Polygon2d& poly, float startX, float startY, float endX, float endY);
+    const Polygon2d& poly, float startX, float startY, float endX, float endY);
 
 /**
  * Check if a point is inside a polygon.
@@ -71,6 +88,6 @@ RaycastResult GD_API PolygonRaycastTest(
  *
  * \ingroup GameEngine
  */
-bool GD_API IsPointInsidePolygon(Polygon2d& poly, float x, float y);
+bool GD_API IsPointInsidePolygon(const Polygon2d& poly, float x, float y);
 
 #endif  // POLYGONCOLLISION_H
@@ -36,7 +36,7 @@ bool ResourcesLoader::SetResourceFile(const gd::String& filename) {
 void ResourcesLoader::LoadSFMLImage(const gd::String& filename,
                                     sf::Image& image) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    const char* buffer = resFile.GetFile(filename);
     if (buffer == NULL)
       cout << "Failed to get the file of a SFML image from resource file: "
            << filename << endl;
@@ -44,6 +44,7 @@ void ResourcesLoader::LoadSFMLImage(const gd::String& filename,
     if (!image.loadFromMemory(buffer, resFile.GetFileSize(filename)))
       cout << "Failed to load a SFML image from resource file: " << filename
            << endl;
+    resFile.ReleaseFile(filename);
   } else {
     gd::SFMLFileStream stream;
     if (!stream.open(filename) || !image.loadFromStream(stream))
@@ -62,7 +63,7 @@ sf::Texture ResourcesLoader::LoadSFMLTexture(const gd::String& filename) {
 void ResourcesLoader::LoadSFMLTexture(const gd::String& filename,
                                       sf::Texture& texture) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    const char* buffer = resFile.GetFile(filename);
     if (buffer == NULL)
       cout << "Failed to get the file of a SFML texture from resource file: "
            << filename << endl;
@@ -70,6 +71,7 @@ void ResourcesLoader::LoadSFMLTexture(const gd::String& filename,
     if (!texture.loadFromMemory(buffer, resFile.GetFileSize(filename)))
       cout << "Failed to load a SFML texture from resource file: " << filename
            << endl;
+    resFile.ReleaseFile(filename);
   } else {
     gd::SFMLFileStream stream;
     if (!stream.open(filename) || !texture.loadFromStream(stream))
@@ -79,8 +81,22 @@ void ResourcesLoader::LoadSFMLTexture(const gd::String& filename,
 
 std::pair<sf::Font*, StreamHolder*> ResourcesLoader::LoadFont(
     const gd::String& filename) {
-  if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+  if (resFile.IsCompressed(filename)) {
+    // Compressed fonts are decompressed progressively, as they are read.
+    sf::Font* font = new sf::Font();
+    StreamHolder* streamHolder = new StreamHolder();
+
+    if (!streamHolder->datFileStream.open(resFile, filename) ||
+        !font->loadFromStream(streamHolder->datFileStream)) {
+      cout << "Failed to load a font from resource file: " << filename << endl;
+      delete font;
+      delete streamHolder;
+      return std::make_pair((sf::Font*)nullptr, (StreamHolder*)nullptr);
+    }
+
+    return std::make_pair(font, streamHolder);
+  } else if (resFile.ContainsFile(filename)) {
+    const char* buffer = resFile.GetFile(filename);
     size_t bufferSize = resFile.GetFileSize(filename);
     if (buffer == nullptr) {
       cout << "Failed to get the file of a font from resource file:" << filename
@@ -88,20 +104,16 @@ std::pair<sf::Font*, StreamHolder*> ResourcesLoader::LoadFont(
       return std::make_pair((sf::Font*)nullptr, (StreamHolder*)nullptr);
     }
 
+    // The font is read directly from the resource file, which stays
+    // in memory as long as the game is running.
     sf::Font* font = new sf::Font();
-    char* fontBuffer = new char[bufferSize];
-    memcpy(fontBuffer, buffer, bufferSize);
-
-    if (!font->loadFromMemory(fontBuffer, bufferSize)) {
+    if (!font->loadFromMemory(buffer, bufferSize)) {
       cout << "Failed to load a font from resource file: " << filename << endl;
       delete font;
-      delete fontBuffer;
       return std::make_pair((sf::Font*)nullptr, (StreamHolder*)nullptr);
     }
 
-    StreamHolder* streamHolder = new StreamHolder();
-    streamHolder->buffer = fontBuffer;
-    return std::make_pair(font, streamHolder);
+    return std::make_pair(font, new StreamHolder());
   } else {
     sf::Font* font = new sf::Font();
     StreamHolder* streamHolder = new StreamHolder();
@@ -122,7 +134,7 @@ sf::SoundBuffer ResourcesLoader::LoadSoundBuffer(const gd::String& filename) {
   sf::SoundBuffer sbuffer;
 
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    const char* buffer = resFile.GetFile(filename);
     if (buffer == NULL)
       cout << "Failed to get the file of a sound buffer from resource file: "
            << filename << endl;
@@ -130,6 +142,7 @@ sf::SoundBuffer ResourcesLoader::LoadSoundBuffer(const gd::String& filename) {
     if (!sbuffer.loadFromMemory(buffer, resFile.GetFileSize(filename)))
       cout << "Failed to load a sound buffer from resource file: " << filename
            << endl;
+    resFile.ReleaseFile(filename);
   } else {
     gd::SFMLFileStream stream;
     if (!stream.open(filename) || !sbuffer.loadFromStream(stream))
@@ -143,14 +156,16 @@ gd::String ResourcesLoader::LoadPlainText(const gd::String& filename) {
   gd::String text;
 
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    const char* buffer = resFile.GetFile(filename);
     if (!buffer) {
       cout << "Failed to read a file from resource file: " << filename << endl;
     } else {
-      text = gd::String::FromUTF8(std::string(buffer));
+      text = gd::String::FromUTF8(
+          std::string(buffer, resFile.GetFileSize(filename)));
     }
+    resFile.ReleaseFile(filename);
   } else {
-    char* buffer = LoadBinaryFile(filename);
+    const char* buffer = LoadBinaryFile(filename);
     if (!buffer)
       cout << "Failed to read plain text from a file: " << filename << endl;
     else {
@@ -165,9 +180,9 @@ gd::String ResourcesLoader::LoadPlainText(const gd::String& filename) {
 /**
  * Load a binary text file
  */
-char* ResourcesLoader::LoadBinaryFile(const gd::String& filename) {
+const char* ResourcesLoader::LoadBinaryFile(const gd::String& filename) {
   if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
+    const char* buffer = resFile.GetFile(filename);
     if (buffer == NULL)
       cout << "Failed to read a binary file from resource file: " << filename
            << endl;
@@ -201,6 +216,14 @@ char* ResourcesLoader::LoadBinaryFile(const gd::String& filename) {
   return NULL;
 }
 
+void ResourcesLoader::ReleaseBinaryFile(const gd::String& filename,
+                                        const char* buffer) {
+  if (resFile.ContainsFile(filename))
+    resFile.ReleaseFile(filename);
+  else
+    delete[] buffer;
+}
+
 long int ResourcesLoader::GetBinaryFileSize(const gd::String& filename) {
   if (resFile.ContainsFile(filename))
     return resFile.GetFileSize(filename);
@@ -220,6 +243,23 @@ long int ResourcesLoader::GetBinaryFileSize(const gd::String& filename) {
   return 0;
 }
 
+sf::InputStream* ResourcesLoader::OpenStream(const gd::String& filename) {
+  if (resFile.ContainsFile(filename)) {
+    DatFileStream* stream = new DatFileStream();
+    if (stream->open(resFile, filename)) return stream;
+
+    delete stream;
+  } else {
+    gd::SFMLFileStream* stream = new gd::SFMLFileStream();
+    if (stream->open(filename)) return stream;
+
+    delete stream;
+  }
+
+  cout << "Unable to open a stream for " << filename << endl;
+  return NULL;
+}
+
 bool ResourcesLoader::HasFile(const gd::String& filename) {
   return resFile.ContainsFile(filename);
 }
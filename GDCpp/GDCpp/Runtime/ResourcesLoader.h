@@ -35,6 +35,8 @@ struct StreamHolder {
 
   char *buffer;
   gd::SFMLFileStream stream;
+  DatFileStream datFileStream;  ///< Used for compressed files of the resource
+                                ///< file.
 };
 
 /**
@@ -62,10 +64,31 @@ class GD_API ResourcesLoader {
 
   gd::String LoadPlainText(const gd::String &filename);
 
-  char *LoadBinaryFile(const gd::String &filename);
+  /**
+   * \brief Return the content of the file.
+   * \note The content must be given back with ReleaseBinaryFile once it is
+   * not used anymore (the content of files of the resource file is not
+   * copied, but compressed files are decompressed and kept in memory until
+   * they are released).
+   */
+  const char *LoadBinaryFile(const gd::String &filename);
+
+  /**
+   * \brief Give back the content of a file returned by LoadBinaryFile.
+   */
+  void ReleaseBinaryFile(const gd::String &filename, const char *buffer);
 
   long int GetBinaryFileSize(const gd::String &filename);
 
+  /**
+   * \brief Open a stream to read the file progressively, without loading it
+   * entirely in memory.
+   *
+   * \return The stream, to be deleted by the caller, or NULL if the file
+   * can't be opened.
+   */
+  sf::InputStream *OpenStream(const gd::String &filename);
+
   bool HasFile(const gd::String &filename);
 
   static ResourcesLoader *Get() {
@@ -0,0 +1,188 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/ResourcesPreloader.h"
+#include <algorithm>
+#include <iostream>
+#include <set>
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Project/ImageManager.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCpp/Runtime/ResourcesLoader.h"
+
+namespace {
+/**
+ * \brief Internal Tool class used by
+ * ResourcesPreloader::GetImagesUsedByInstances
+ */
+class InstancesObjectsNamesGetter : public gd::InitialInstanceFunctor {
+ public:
+  virtual ~InstancesObjectsNamesGetter(){};
+
+  virtual void operator()(gd::InitialInstance& instance) {
+    objectsNames.insert(instance.GetObjectName());
+  }
+
+  std::set<gd::String> objectsNames;
+};
+}  // namespace
+
+ResourcesPreloader::ResourcesPreloader()
+    : imageManager(NULL), imagesCount(0), loadedCount(0), nextTask(0) {}
+
+ResourcesPreloader::~ResourcesPreloader() { StopWorkers(); }
+
+void ResourcesPreloader::PreloadImages(
+    const std::vector<gd::String>& names,
+    const gd::ResourcesManager& resourcesManager,
+    gd::ImageManager& imageManager_) {
+  Finish();
+  StopWorkers();
+
+  imageManager = &imageManager_;
+  tasks.clear();
+  decodedTasks.clear();
+  imagesCount = 0;
+  loadedCount = 0;
+  nextTask = 0;
+
+  std::set<gd::String> alreadyAdded;
+  for (const gd::String& name : names) {
+    if (imageManager->HasLoadedSFMLTexture(name) ||
+        !alreadyAdded.insert(name).second)
+      continue;
+
+    try {
+      const gd::ImageResource& image = dynamic_cast<const gd::ImageResource&>(
+          resourcesManager.GetResource(name));
+
+      Task task;
+      task.name = name;
+      task.file = image.GetFile();
+      task.smooth = image.smooth;
+      tasks.push_back(task);
+    } catch (...) { /*The resource is not an image, we don't care about it.*/
+    }
+  }
+  imagesCount = tasks.size();
+  if (tasks.empty()) return;
+
+  // Make sure the resources loader is created before being used by threads.
+  gd::ResourcesLoader::Get();
+
+  std::size_t workersCount = std::min<std::size_t>(
+      std::max(std::thread::hardware_concurrency(), 1u), tasks.size());
+  for (std::size_t i = 0; i < workersCount; ++i)
+    workers.push_back(std::thread(&ResourcesPreloader::DecodeImages, this));
+}
+
+void ResourcesPreloader::DecodeImages() {
+  while (true) {
+    std::size_t taskIndex;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (nextTask >= tasks.size()) return;
+      taskIndex = nextTask++;
+    }
+
+    Task& task = tasks[taskIndex];
+    task.texture = std::make_shared<SFMLTextureWrapper>();
+    gd::ResourcesLoader::Get()->LoadSFMLImage(task.file, task.texture->image);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      decodedTasks.push_back(taskIndex);
+    }
+    imageDecoded.notify_one();
+  }
+}
+
+bool ResourcesPreloader::Update() {
+  std::deque<std::size_t> newDecodedTasks;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    newDecodedTasks.swap(decodedTasks);
+  }
+
+  for (std::size_t taskIndex : newDecodedTasks) {
+    Task& task = tasks[taskIndex];
+    task.texture->texture.loadFromImage(task.texture->image);
+    task.texture->texture.setSmooth(task.smooth);
+    imageManager->SetSFMLTexture(task.name, task.texture);
+
+    textures.push_back(task.texture);
+    task.texture.reset();
+    loadedCount++;
+  }
+
+  if (loadedCount < tasks.size()) return false;
+
+  StopWorkers();
+  return true;
+}
+
+void ResourcesPreloader::Finish() {
+  while (!Update()) {
+    std::unique_lock<std::mutex> lock(mutex);
+    imageDecoded.wait(lock, [this]() { return !decodedTasks.empty(); });
+  }
+}
+
+void ResourcesPreloader::Clear() {
+  StopWorkers();
+  tasks.clear();
+  decodedTasks.clear();
+  imagesCount = 0;
+  loadedCount = 0;
+  nextTask = 0;
+  textures.clear();
+}
+
+void ResourcesPreloader::StopWorkers() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    nextTask = tasks.size();
+  }
+
+  for (std::thread& worker : workers) worker.join();
+  workers.clear();
+}
+
+std::vector<gd::String> ResourcesPreloader::GetImagesUsedByInstances(
+    const gd::Project& project,
+    const gd::Layout& layout,
+    const gd::InitialInstancesContainer& instances) {
+  InstancesObjectsNamesGetter objectsNamesGetter;
+  const_cast<gd::InitialInstancesContainer&>(instances).IterateOverInstances(
+      objectsNamesGetter);
+
+  std::vector<gd::String> images;
+  for (const gd::String& objectName : objectsNamesGetter.objectsNames) {
+    const gd::Object* object = NULL;
+    if (layout.HasObjectNamed(objectName))
+      object = &layout.GetObject(objectName);
+    else if (project.HasObjectNamed(objectName))
+      object = &project.GetObject(objectName);
+
+    const gd::SpriteObject* spriteObject =
+        dynamic_cast<const gd::SpriteObject*>(object);
+    if (!spriteObject) continue;
+
+    for (std::size_t i = 0; i < spriteObject->GetAnimationsCount(); ++i) {
+      const gd::Animation& animation = spriteObject->GetAnimation(i);
+      for (std::size_t j = 0; j < animation.GetDirectionsCount(); ++j) {
+        const gd::Direction& direction = animation.GetDirection(j);
+        for (std::size_t k = 0; k < direction.GetSpritesCount(); ++k)
+          images.push_back(direction.GetSprite(k).GetImageName());
+      }
+    }
+  }
+
+  return images;
+}
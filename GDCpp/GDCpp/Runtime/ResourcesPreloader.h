@@ -0,0 +1,144 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCPP_RESOURCESPRELOADER_H
+#define GDCPP_RESOURCESPRELOADER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+namespace gd {
+class ImageManager;
+class InitialInstancesContainer;
+class Layout;
+class Project;
+class ResourcesManager;
+}
+class SFMLTextureWrapper;
+
+/**
+ * \brief Decode images in background threads, so that only the creation of
+ * their textures (which must be done by the main thread) is left when a scene
+ * is loaded.
+ *
+ * Images are decoded by a pool of threads, while the main thread calls Update
+ * to create the textures of the images decoded so far (or Finish to wait for
+ * all of them). The textures are kept alive as long as the preloader, or until
+ * ReleaseTextures or Clear is called.
+ *
+ * \note Only images are preloaded: sounds and fonts are still loaded when
+ * they are first used.
+ *
+ * \see RuntimeScene::LoadFromSceneAndCustomInstances
+ * \ingroup ResourcesManagement
+ */
+class GD_API ResourcesPreloader {
+ public:
+  ResourcesPreloader();
+  ~ResourcesPreloader();
+  ResourcesPreloader(const ResourcesPreloader&) = delete;
+  ResourcesPreloader& operator=(const ResourcesPreloader&) = delete;
+
+  /**
+   * \brief Start decoding the images that are not already loaded by the image
+   * manager.
+   *
+   * \note If images are still being preloaded, they are loaded first.
+   */
+  void PreloadImages(const std::vector<gd::String>& names,
+                     const gd::ResourcesManager& resourcesManager,
+                     gd::ImageManager& imageManager);
+
+  /**
+   * \brief Create the textures of the images decoded so far, and give them to
+   * the image manager. Must be called by the main thread.
+   *
+   * \return true if all the images are loaded.
+   */
+  bool Update();
+
+  /**
+   * \brief Wait for all the images to be decoded, and create their textures.
+   * Must be called by the main thread.
+   */
+  void Finish();
+
+  /**
+   * \brief Return the number of images that are preloaded, and the number of
+   * images that are loaded.
+   *
+   * \note Can be called by any thread.
+   */
+  std::size_t GetImagesCount() const { return imagesCount; }
+  std::size_t GetLoadedImagesCount() const { return loadedCount; }
+
+  /**
+   * \brief Return the progress of the preloading, between 0 and 1.
+   *
+   * \note Can be called by any thread.
+   */
+  float GetProgress() const {
+    std::size_t count = imagesCount;
+    return count == 0 ? 1.0f : static_cast<float>(loadedCount) / count;
+  }
+
+  /**
+   * \brief Stop keeping alive the textures of the images loaded so far, once
+   * they are used by something else (typically the objects of a scene).
+   */
+  void ReleaseTextures() { textures.clear(); }
+
+  /**
+   * \brief Stop the preloading and release the textures of the images.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the images used by the objects of the instances, found in
+   * the layout or in the global objects of the project.
+   *
+   * \note Only the images of sprite objects are found, as other objects don't
+   * expose their resources in games.
+   */
+  static std::vector<gd::String> GetImagesUsedByInstances(
+      const gd::Project& project,
+      const gd::Layout& layout,
+      const gd::InitialInstancesContainer& instances);
+
+ private:
+  struct Task {
+    gd::String name;
+    gd::String file;
+    bool smooth;
+    std::shared_ptr<SFMLTextureWrapper> texture;
+  };
+
+  void DecodeImages();
+  void StopWorkers();
+
+  gd::ImageManager* imageManager;
+  std::vector<Task> tasks;  ///< The images being preloaded.
+  std::atomic<std::size_t> imagesCount;  ///< The number of images being
+                                         ///< preloaded.
+  std::atomic<std::size_t> loadedCount;  ///< The number of images with a
+                                         ///< texture created.
+  std::vector<std::shared_ptr<SFMLTextureWrapper> >
+      textures;  ///< The preloaded textures, kept alive.
+
+  std::vector<std::thread> workers;
+  std::mutex mutex;
+  std::condition_variable imageDecoded;
+  std::size_t nextTask;  ///< The next image to decode (protected by mutex).
+  std::deque<std::size_t>
+      decodedTasks;  ///< The images decoded since the last call to Update
+                     ///< (protected by mutex).
+};
+
+#endif  // GDCPP_RESOURCESPRELOADER_H
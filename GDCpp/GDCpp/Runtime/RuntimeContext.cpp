@@ -1,30 +1,69 @@
 #include "RuntimeContext.h"
+#include <algorithm>
 #include <vector>
 #include "GDCpp/Runtime/RuntimeGame.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
 #include "GDCpp/Runtime/profile.h"
 
+std::atomic<std::size_t> RuntimeContext::lastId(0);
+
 bool RuntimeContext::TriggerOnce(std::size_t conditionId) {
-  onceConditionsTriggered[conditionId] =
-      true;  // Remember that we triggered this condition.
+  std::vector<bool> &triggered = onceConditionsTriggered[currentFrame];
+  std::vector<bool> &triggeredLastFrame =
+      onceConditionsTriggered[1 - currentFrame];
+  if (conditionId >= triggered.size()) {
+    triggered.resize(conditionId + 1, false);
+    triggeredLastFrame.resize(conditionId + 1, false);
+  }
+
+  triggered[conditionId] = true;  // Remember that we triggered this condition.
 
   // Return true only if the condition was not triggered the last frame.
-  std::map<std::size_t, bool>::iterator lastFrame =
-      onceConditionsTriggeredLastFrame.find(conditionId);
-  return lastFrame == onceConditionsTriggeredLastFrame.end() ||
-         lastFrame->second == false;
+  return !triggeredLastFrame[conditionId];
 }
 
 void RuntimeContext::StartNewFrame() {
-  onceConditionsTriggeredLastFrame = onceConditionsTriggered;
-  onceConditionsTriggered.clear();
+  // The conditions triggered during the frame become the ones of the last
+  // frame, without copying them.
+  currentFrame = 1 - currentFrame;
+  std::vector<bool> &triggered = onceConditionsTriggered[currentFrame];
+  std::fill(triggered.begin(), triggered.end(), false);
+}
+
+void RuntimeContext::ResolveTriggerOnceConditions(
+    RuntimeTriggerOnceConditions &conditions) {
+  conditions.contextId = id;
+  for (auto &offset : triggerOnceOffsets) {
+    if (offset.first == &conditions) {
+      conditions.offset = offset.second;
+      return;
+    }
+  }
+
+  // Give to the conditions a range after the ones already given.
+  conditions.offset = onceConditionsTriggered[currentFrame].size();
+  triggerOnceOffsets.push_back(
+      std::make_pair(&conditions, conditions.offset));
+  for (auto &triggered : onceConditionsTriggered)
+    triggered.resize(conditions.offset + conditions.count, false);
 }
 
-std::vector<RuntimeObject *> RuntimeContext::GetObjectsRawPointers(
+const std::vector<RuntimeObject *> &RuntimeContext::GetObjectsRawPointers(
     const gd::String &name) {
   return scene->objectsInstances.GetObjectsRawPointers(name);
 }
 
+const std::vector<RuntimeObject *> &RuntimeContext::GetObjectsRawPointers(
+    RuntimeObjectSlot &objectSlot) {
+  ObjInstancesHolder &objectsInstances = scene->objectsInstances;
+  if (objectSlot.slotsId != objectsInstances.GetSlotsId()) {
+    objectSlot.slot = objectsInstances.GetObjectSlot(objectSlot.name);
+    objectSlot.slotsId = objectsInstances.GetSlotsId();
+  }
+
+  return objectsInstances.GetObjectsRawPointers(objectSlot.slot);
+}
+
 RuntimeVariablesContainer &RuntimeContext::GetSceneVariables() {
   return scene->GetVariables();
 }
@@ -40,13 +79,13 @@ RuntimeContext &RuntimeContext::ClearObjectListsMap() {
 }
 
 RuntimeContext &RuntimeContext::AddObjectListToMap(
-    const gd::String &objectName, std::vector<RuntimeObject *> &list) {
-  temporaryMap[objectName] = &list;
+    const RuntimeObjectSlot &objectSlot, std::vector<RuntimeObject *> &list) {
+  temporaryMap.Add(objectSlot.name, list);
 
   return *this;
 }
 
-std::map<gd::String, std::vector<RuntimeObject *> *>
+RuntimeObjectsLists
 RuntimeContext::ReturnObjectListsMap() {
   return temporaryMap;
 }
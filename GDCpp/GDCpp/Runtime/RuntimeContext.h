@@ -1,14 +1,57 @@
 #ifndef RUNTIMECONTEXT_H
 #define RUNTIMECONTEXT_H
 
+#include <atomic>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 #include "GDCpp/Runtime/String.h"
 class RuntimeObject;
 class RuntimeScene;
 class RuntimeVariablesContainer;
 
+/**
+ * \brief Cache for the slot of an object name in the objects of a scene.
+ *
+ * Events generated code declares one static RuntimeObjectSlot per object name
+ * so that the name is resolved only once per scene, instead of being hashed
+ * each time an event needs the list of the objects.
+ *
+ * \see ObjInstancesHolder::GetObjectSlot
+ */
+struct GD_API RuntimeObjectSlot {
+  RuntimeObjectSlot(const gd::String &name_)
+      : name(name_), slotsId(0), slot(0){};
+
+  gd::String name;      ///< The name of the objects.
+  std::size_t slotsId;  ///< The identifier of the slots when the slot was
+                        ///< resolved (0 if not resolved yet).
+  std::size_t slot;     ///< The slot of the objects.
+};
+
+/**
+ * \brief The "Trigger once" conditions of events generated code (a scene or
+ * external events).
+ *
+ * Events generated code declares one static RuntimeTriggerOnceConditions with
+ * the number of its "Trigger once" conditions, so that they are given a range
+ * of identifiers by each RuntimeContext running the code. The range is
+ * resolved only once per context.
+ *
+ * \see RuntimeContext::TriggerOnce
+ */
+struct GD_API RuntimeTriggerOnceConditions {
+  RuntimeTriggerOnceConditions(std::size_t count_)
+      : count(count_), contextId(0), offset(0){};
+
+  std::size_t count;      ///< The number of conditions.
+  std::size_t contextId;  ///< The identifier of the context when the range was
+                          ///< resolved (0 if not resolved yet).
+  std::size_t offset;     ///< The identifier of the first condition.
+};
+
 /**
  * \brief Helper class used by events generated code to get access to
  * various things without including "heavy" classes such as RuntimeScene.
@@ -19,7 +62,8 @@ class GD_API RuntimeContext {
    * \brief Construct the context for a scene.
    * \param scene The scene associated to the context.
    */
-  RuntimeContext(RuntimeScene *scene_) : scene(scene_){};
+  RuntimeContext(RuntimeScene *scene_)
+      : scene(scene_), id(++lastId), currentFrame(0){};
   virtual ~RuntimeContext(){};
 
   /**
@@ -28,7 +72,17 @@ class GD_API RuntimeContext {
    * scene->objectsInstances.GetObjectsRawPointers(name)
    * \endcode
    */
-  std::vector<RuntimeObject *> GetObjectsRawPointers(const gd::String &name);
+  const std::vector<RuntimeObject *> &GetObjectsRawPointers(
+      const gd::String &name);
+
+  /**
+   * \brief Get a "raw pointers" list to objects using a cached slot.
+   *
+   * The slot is resolved from the object name only if it was not yet resolved
+   * for the objects of the scene.
+   */
+  const std::vector<RuntimeObject *> &GetObjectsRawPointers(
+      RuntimeObjectSlot &objectSlot);
 
   /**
    * \brief Shortcut for scene->GetVariables();
@@ -46,23 +100,53 @@ class GD_API RuntimeContext {
    */
   bool TriggerOnce(std::size_t conditionId);
 
+  /**
+   * \brief Used by "Trigger once" conditions of events generated code: same as
+   * TriggerOnce, with \a conditionId being relative to the range of \a
+   * conditions.
+   */
+  bool TriggerOnce(RuntimeTriggerOnceConditions &conditions,
+                   std::size_t conditionId) {
+    if (conditions.contextId != id) ResolveTriggerOnceConditions(conditions);
+    return TriggerOnce(conditions.offset + conditionId);
+  }
+
   /**
    * \brief To be called when events begin so that "Trigger once" conditions
    * are properly handled.
    */
   void StartNewFrame();
 
+  /**
+   * \brief Used by events generated code to build the lists of objects given
+   * to a function.
+   * \note Lists are associated to the name of the objects of \a objectSlot,
+   * which must outlive the lists (it is usually static).
+   */
   RuntimeContext &ClearObjectListsMap();
-  RuntimeContext &AddObjectListToMap(const gd::String &objectName,
+  RuntimeContext &AddObjectListToMap(const RuntimeObjectSlot &objectSlot,
                                      std::vector<RuntimeObject *> &list);
-  std::map<gd::String, std::vector<RuntimeObject *> *> ReturnObjectListsMap();
+  RuntimeObjectsLists ReturnObjectListsMap();
 
   RuntimeScene *scene;  ///< The associated scene.
 
  private:
-  std::map<gd::String, std::vector<RuntimeObject *> *> temporaryMap;
-  std::map<std::size_t, bool> onceConditionsTriggered;
-  std::map<std::size_t, bool> onceConditionsTriggeredLastFrame;
+  void ResolveTriggerOnceConditions(RuntimeTriggerOnceConditions &conditions);
+
+  RuntimeObjectsLists temporaryMap;
+
+  std::size_t id;  ///< Identify the context (see RuntimeTriggerOnceConditions).
+  std::vector<bool> onceConditionsTriggered[2];  ///< The "Trigger once"
+                                                 ///< conditions triggered
+                                                 ///< during the current frame
+                                                 ///< and the last frame.
+  std::size_t currentFrame;  ///< The index, in onceConditionsTriggered, of the
+                             ///< conditions triggered during the current frame.
+  std::vector<std::pair<const RuntimeTriggerOnceConditions *, std::size_t> >
+      triggerOnceOffsets;  ///< The offset given to the conditions of each
+                           ///< events generated code.
+
+  static std::atomic<std::size_t> lastId;
 };
 
 #endif  // RUNTIMECONTEXT_H
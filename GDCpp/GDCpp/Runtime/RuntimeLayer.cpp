@@ -5,6 +5,8 @@
  */
 #include "RuntimeLayer.h"
 #include <SFML/Graphics.hpp>
+#include <cmath>
+#include "GDCore/CommonTools.h"
 #include "GDCpp/Runtime/Project/Layer.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
 
@@ -71,6 +73,23 @@ void RuntimeCamera::SetSize(float width_, float height_) {
   zoomFactor = 1;
 }
 
+sf::FloatRect RuntimeCamera::GetVisibleArea() const {
+  float width = GetWidth();
+  float height = GetHeight();
+  if (angle != 0) {
+    float angleInRadians = angle * gd::Pi() / 180.0;
+    float cosAngle = std::abs(std::cos(angleInRadians));
+    float sinAngle = std::abs(std::sin(angleInRadians));
+    float rotatedWidth = width * cosAngle + height * sinAngle;
+    height = width * sinAngle + height * cosAngle;
+    width = rotatedWidth;
+  }
+
+  const sf::Vector2f& center = GetViewCenter();
+  return sf::FloatRect(
+      center.x - width / 2, center.y - height / 2, width, height);
+}
+
 void RuntimeCamera::SetViewport(float x1, float y1, float x2, float y2) {
   sfmlView.setViewport(sf::FloatRect(x1, y1, x2 - x1, y2 - y1));
 }
@@ -99,6 +99,12 @@ class GD_API RuntimeCamera {
     return zoomFactor != 0 ? originalHeight * 1.0 / zoomFactor : 0;
   };
 
+  /**
+   * \brief Get the area of the scene rendered by the camera, taking its
+   * rotation into account.
+   */
+  sf::FloatRect GetVisibleArea() const;
+
   /**
    * Change the position of the view on the scene.
    */
@@ -17,9 +17,23 @@
 #include "GDCpp/Runtime/Project/Behavior.h"
 #include "GDCpp/Runtime/Project/Object.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
 
 using namespace std;
 
+std::atomic<std::size_t> RuntimeBehaviorsNames::lastId(0);
+
+RuntimeBehaviorsNames::RuntimeBehaviorsNames(
+    const std::vector<gd::String> &names_)
+    : names(names_), id(++lastId) {}
+
+std::size_t RuntimeBehaviorsNames::GetIndex(const gd::String &name) const {
+  for (std::size_t i = 0; i < names.size(); ++i)
+    if (names[i] == name) return i;
+
+  return names.size();
+}
+
 RuntimeObject::RuntimeObject(RuntimeScene &scene, const gd::Object &object)
     : name(object.GetName()),
       type(object.GetType()),
@@ -27,21 +41,58 @@ RuntimeObject::RuntimeObject(RuntimeScene &scene, const gd::Object &object)
       Y(0),
       zOrder(0),
       hidden(false),
-      objectVariables(object.GetVariables()) {
+      objectVariables(object.GetVariables()),
+      initialName(object.GetName()),
+      instancesSlot(0),
+      instancesIndex(0),
+      allObjectsIndex(0),
+      renderedFrame(0),
+      renderedLayer(0),
+      renderedIndex(0) {
   ClearForce();
+  CreateBehaviors(scene, object);
+}
 
+void RuntimeObject::CreateBehaviors(RuntimeScene &scene,
+                                    const gd::Object &object) {
   behaviors.clear();
-  // Insert the new behaviors.
-  for (auto it = object.GetAllBehaviors().cbegin();
-       it != object.GetAllBehaviors().cend();
-       ++it) {
-    behaviors[it->first] = std::unique_ptr<gd::Behavior>(it->second->Clone());
-    behaviors[it->first]->SetOwner(this);
+  // Insert the new behaviors, in the order of their names.
+  behaviorsNames = scene.GetBehaviorsNames(object);
+  for (const gd::String &behaviorName : behaviorsNames->names) {
+    behaviors.push_back(std::unique_ptr<gd::Behavior>(
+        object.GetBehavior(behaviorName).Clone()));
+    behaviors.back()->SetOwner(this);
   }
 }
 
+void RuntimeObject::Reset(RuntimeScene &scene, const gd::Object &object) {
+  name = object.GetName();
+  X = 0;
+  Y = 0;
+  zOrder = 0;
+  hidden = false;
+  layer.clear();
+  objectVariables = object.GetVariables();
+  ClearForce();
+  initialName = object.GetName();
+  instancesSlot = 0;  // Set by the ObjInstancesHolder when the object is added.
+  instancesIndex = 0;
+  allObjectsIndex = 0;
+  renderedFrame = 0;  // Set by the RuntimeScene when the object is rendered.
+  renderedLayer = 0;
+  renderedIndex = 0;
+
+  CreateBehaviors(scene, object);
+}
+
 RuntimeObject::~RuntimeObject() {}
 
+bool RuntimeObject::DrawInBatch(sf::RenderTarget &renderTarget,
+                                SpriteBatch &batch) {
+  batch.Flush(renderTarget);
+  return Draw(renderTarget);
+}
+
 void RuntimeObject::Init(const RuntimeObject &object) {
   name = object.name;
   type = object.type;
@@ -54,12 +105,21 @@ void RuntimeObject::Init(const RuntimeObject &object) {
   layer = object.layer;
   force5 = object.force5;
   forces = object.forces;
+  hitBoxes = object.hitBoxes;
+  aabb = object.aabb;
+  initialName = object.initialName;
+  instancesSlot = 0;  // Set by the ObjInstancesHolder when the object is added.
+  instancesIndex = 0;
+  allObjectsIndex = 0;
+  renderedFrame = 0;  // Set by the RuntimeScene when the object is rendered.
+  renderedLayer = 0;
+  renderedIndex = 0;
 
   behaviors.clear();
-  for (auto it = object.behaviors.cbegin(); it != object.behaviors.cend();
-       ++it) {
-    behaviors[it->first] = std::unique_ptr<gd::Behavior>(it->second->Clone());
-    behaviors[it->first]->SetOwner(this);
+  behaviorsNames = object.behaviorsNames;
+  for (auto &behavior : object.behaviors) {
+    behaviors.push_back(std::unique_ptr<gd::Behavior>(behavior->Clone()));
+    behaviors.back()->SetOwner(this);
   }
 }
 
@@ -223,15 +283,14 @@ void RuntimeObject::AddForceToMoveAround(float positionX,
 
 void RuntimeObject::Duplicate(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    RuntimeObjectsLists pickedObjectLists) {
   RuntimeObject *newObject =
       scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(Clone()));
 
-  if (pickedObjectLists[name] != NULL &&
-      find(pickedObjectLists[name]->begin(),
-           pickedObjectLists[name]->end(),
-           newObject) == pickedObjectLists[name]->end())
-    pickedObjectLists[name]->push_back(newObject);
+  std::vector<RuntimeObject *> *list = pickedObjectLists.Get(name);
+  if (list != NULL &&
+      find(list->begin(), list->end(), newObject) == list->end())
+    list->push_back(newObject);
 }
 
 bool RuntimeObject::IsStopped() { return TotalForceLength() == 0; }
@@ -283,10 +342,10 @@ double RuntimeObject::GetDistanceWithObject(RuntimeObject *object) {
 }
 
 bool RuntimeObject::SeparateFromObjects(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    RuntimeObjectsLists pickedObjectLists,
     bool ignoreTouchingEdges) {
   vector<RuntimeObject *> objects;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
+  for (RuntimeObjectsLists::const_iterator it =
            pickedObjectLists.begin();
        it != pickedObjectLists.end();
        ++it) {
@@ -306,12 +365,14 @@ bool RuntimeObject::SeparateFromObjects(
   sf::Vector2f moveVector;
   for (std::size_t j = 0; j < objects.size(); ++j) {
     if (objects[j] != this) {
-      std::vector<Polygon2d> hitBoxes = GetHitBoxes(objects[j]->GetAABB());
-      vector<Polygon2d> otherHitBoxes = objects[j]->GetHitBoxes(GetAABB());
-      for (std::size_t k = 0; k < hitBoxes.size(); ++k) {
+      const std::vector<Polygon2d> &objectHitBoxes =
+          GetHitBoxes(objects[j]->GetAABB());
+      const vector<Polygon2d> &otherHitBoxes =
+          objects[j]->GetHitBoxes(GetAABB());
+      for (std::size_t k = 0; k < objectHitBoxes.size(); ++k) {
         for (std::size_t l = 0; l < otherHitBoxes.size(); ++l) {
           CollisionResult result = PolygonCollisionTest(
-              hitBoxes[k], otherHitBoxes[l], ignoreTouchingEdges);
+              objectHitBoxes[k], otherHitBoxes[l], ignoreTouchingEdges);
           if (result.collision) {
             moveVector += result.move_axis;
             moved = true;
@@ -395,24 +456,21 @@ bool RuntimeObject::IsCollidingWith(RuntimeObject *obj2,
   sf::FloatRect objRect = obj1->GetAABB();
   sf::FloatRect obj2Rect = obj2->GetAABB();
 
-  vector<Polygon2d> objHitboxes = obj1->GetHitBoxes(obj2Rect);
-  vector<Polygon2d> obj2Hitboxes = obj2->GetHitBoxes(objRect);
+  const vector<Polygon2d> &objHitboxes = obj1->GetHitBoxes(obj2Rect);
+  const vector<Polygon2d> &obj2Hitboxes = obj2->GetHitBoxes(objRect);
   for (std::size_t k = 0; k < objHitboxes.size(); ++k) {
-    for (std::size_t l = 0; l < obj2Hitboxes.size(); ++l) {
-      if (PolygonCollisionTest(
-              objHitboxes[k], obj2Hitboxes[l], ignoreTouchingEdges)
-              .collision)
-        return true;
-    }
+    if (IsPolygonCollidingWithAny(
+            objHitboxes[k], obj2Hitboxes, ignoreTouchingEdges))
+      return true;
   }
 
   return false;
 }
 
 bool RuntimeObject::IsCollidingWithPoint(float pointX, float pointY) {
-  vector<Polygon2d> hitBoxes = GetHitBoxes();
-  for (std::size_t i = 0; i < hitBoxes.size(); ++i) {
-    if (IsPointInsidePolygon(hitBoxes[i], pointX, pointY)) return true;
+  const vector<Polygon2d> &objectHitBoxes = GetHitBoxes();
+  for (std::size_t i = 0; i < objectHitBoxes.size(); ++i) {
+    if (IsPointInsidePolygon(objectHitBoxes[i], pointX, pointY)) return true;
   }
 
   return false;
@@ -436,7 +494,7 @@ RaycastResult RuntimeObject::RaycastTest(
 
   float testSqDist = closest ? sqDist : 0.0f;
 
-  vector<Polygon2d> hitboxes = GetHitBoxes();
+  const vector<Polygon2d> &hitboxes = GetHitBoxes();
   for (std::size_t i = 0; i < hitboxes.size(); ++i) {
     RaycastResult res = PolygonRaycastTest(hitboxes[i], x, y, endX, endY);
 
@@ -456,9 +514,9 @@ RaycastResult RuntimeObject::RaycastTest(
 }
 
 void RuntimeObject::SeparateObjectsWithoutForces(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    RuntimeObjectsLists pickedObjectLists) {
   vector<RuntimeObject *> objects2;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
+  for (RuntimeObjectsLists::const_iterator it =
            pickedObjectLists.begin();
        it != pickedObjectLists.end();
        ++it) {
@@ -496,9 +554,9 @@ void RuntimeObject::SeparateObjectsWithoutForces(
 }
 
 void RuntimeObject::SeparateObjectsWithForces(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    RuntimeObjectsLists pickedObjectLists) {
   vector<RuntimeObject *> objects2;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
+  for (RuntimeObjectsLists::const_iterator it =
            pickedObjectLists.begin();
        it != pickedObjectLists.end();
        ++it) {
@@ -593,7 +651,7 @@ void RuntimeObject::SetXY(const char *xOperator,
     SetY(GetY() / yValue);
 }
 
-sf::FloatRect RuntimeObject::GetAABB() const {
+const sf::FloatRect &RuntimeObject::GetAABB() const {
   sf::FloatRect notTransformedAABB(
       -GetCenterX(), -GetCenterY(), GetWidth(), GetHeight());
 
@@ -608,20 +666,21 @@ sf::FloatRect RuntimeObject::GetAABB() const {
   sf::Transform resultTransform;
   resultTransform = translationTransform * rotationTransform;
 
-  return resultTransform.transformRect(notTransformedAABB);
+  aabb = resultTransform.transformRect(notTransformedAABB);
+  return aabb;
 }
 
-std::vector<Polygon2d> RuntimeObject::GetHitBoxes() const {
-  std::vector<Polygon2d> mask;
-  Polygon2d rectangle = Polygon2d::CreateRectangle(GetWidth(), GetHeight());
-  rectangle.Rotate(GetAngle() / 180 * 3.14159);
-  rectangle.Move(GetX() + GetCenterX(), GetY() + GetCenterY());
+const std::vector<Polygon2d> &RuntimeObject::GetHitBoxes() const {
+  hitBoxes.resize(1);
+  hitBoxes[0] = Polygon2d::CreateRectangle(GetWidth(), GetHeight());
+  hitBoxes[0].Rotate(GetAngle() / 180 * 3.14159);
+  hitBoxes[0].Move(GetX() + GetCenterX(), GetY() + GetCenterY());
 
-  mask.push_back(rectangle);
-  return mask;
+  return hitBoxes;
 }
 
-std::vector<Polygon2d> RuntimeObject::GetHitBoxes(sf::FloatRect hint) const {
+const std::vector<Polygon2d> &RuntimeObject::GetHitBoxes(
+    sf::FloatRect hint) const {
   return GetHitBoxes();
 }
 
@@ -653,11 +712,13 @@ bool RuntimeObject::CursorOnObject(RuntimeScene &scene, bool) {
 }
 
 Behavior *RuntimeObject::GetBehaviorRawPointer(const gd::String &name) {
-  return behaviors.find(name)->second.get();
+  std::size_t index = behaviorsNames->GetIndex(name);
+  return index < behaviors.size() ? behaviors[index].get() : NULL;
 }
 
 Behavior *RuntimeObject::GetBehaviorRawPointer(const gd::String &name) const {
-  return behaviors.find(name)->second.get();
+  std::size_t index = behaviorsNames->GetIndex(name);
+  return index < behaviors.size() ? behaviors[index].get() : NULL;
 }
 
 bool RuntimeObject::ClearForce() {
@@ -722,13 +783,11 @@ float RuntimeObject::TotalForceLength() const {
 }
 
 void RuntimeObject::DoBehaviorsPreEvents(RuntimeScene &scene) {
-  for (auto it = behaviors.cbegin(); it != behaviors.cend(); ++it)
-    it->second->StepPreEvents(scene);
+  for (auto &behavior : behaviors) behavior->StepPreEvents(scene);
 }
 
 void RuntimeObject::DoBehaviorsPostEvents(RuntimeScene &scene) {
-  for (auto it = behaviors.cbegin(); it != behaviors.cend(); ++it)
-    it->second->StepPostEvents(scene);
+  for (auto &behavior : behaviors) behavior->StepPostEvents(scene);
 }
 
 bool RuntimeObject::VariableExists(const gd::String &variable) {
@@ -7,13 +7,16 @@
 #define RUNTIMEOBJECT_H
 
 #include <SFML/Graphics/Rect.hpp>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 #include "GDCore/Tools/MakeUnique.h"
 #include "GDCpp/Runtime/Force.h"
+#include "GDCpp/Runtime/Polygon2d.h"
 #include "GDCpp/Runtime/Project/Behavior.h"
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
 #include "GDCpp/Runtime/RuntimeVariablesContainer.h"
 #include "GDCpp/Runtime/String.h"
 namespace gd {
@@ -25,10 +28,56 @@ class Object;
 namespace sf {
 class RenderTarget;
 }
-class Polygon2d;
 class RaycastResult;
+class SFMLTextureWrapper;
+class SpriteBatch;
 class RuntimeScene;
 
+/**
+ * \brief The names of the behaviors of the objects of a type, in the order the
+ * behaviors are stored by these objects.
+ *
+ * The names are resolved once per object type by the scene, and shared by all
+ * the objects of this type.
+ *
+ * \see RuntimeScene::GetBehaviorsNames
+ */
+struct GD_API RuntimeBehaviorsNames {
+  RuntimeBehaviorsNames(const std::vector<gd::String>& names_);
+
+  /**
+   * \brief Return the index of the behavior with the specified name, or the
+   * number of behaviors if there is no such behavior.
+   */
+  std::size_t GetIndex(const gd::String& name) const;
+
+  std::vector<gd::String> names;  ///< The names of the behaviors.
+  std::size_t id;  ///< The identifier of the names, unique for the game.
+
+ private:
+  static std::atomic<std::size_t> lastId;
+};
+
+/**
+ * \brief Cache for the index of a behavior name in the behaviors of objects.
+ *
+ * Events generated code declares one static RuntimeBehaviorSlot per behavior
+ * name so that the name is resolved only once per object type, instead of
+ * being searched each time a behavior action or condition is run.
+ *
+ * \see RuntimeObject::GetBehaviorRawPointer
+ */
+struct GD_API RuntimeBehaviorSlot {
+  RuntimeBehaviorSlot(const gd::String& name_)
+      : name(name_), behaviorsNamesId(0), index(0){};
+
+  gd::String name;               ///< The name of the behavior.
+  std::size_t behaviorsNamesId;  ///< The identifier of the behaviors names when
+                                 ///< the index was resolved (0 if not resolved
+                                 ///< yet).
+  std::size_t index;             ///< The index of the behavior.
+};
+
 /**
  * \brief A RuntimeObject is something displayed on the scene.
  *
@@ -119,6 +168,34 @@ class GD_API RuntimeObject {
     return gd::make_unique<RuntimeObject>(*this);
   }
 
+  /**
+   * \brief Redefine this method to return true if the object can be recycled
+   * by a RuntimeObjectsPool, i.e: if Reset is redefined to reset all the
+   * members of the object.
+   */
+  virtual bool CanBeRecycled() const { return false; }
+
+  /**
+   * \brief Reset the object to the state of an object just created from \a
+   * object, so that a recycled object behaves like a new one.
+   *
+   * \a object is always the object the RuntimeObject was created from (the
+   * objects are recycled with the objects of the same name), so what is copied
+   * from it and never changed afterwards (like resources) can be kept.
+   *
+   * Redefine this method to reset the members of your object, calling the
+   * original method first:
+   * \code
+   * void MyRuntimeObject::Reset(RuntimeScene & scene, const gd::Object & object)
+   * {
+   *     RuntimeObject::Reset(scene, object);
+   *     //...
+   * }
+   * \endcode
+   * \see RuntimeObjectsPool
+   */
+  virtual void Reset(RuntimeScene& scene, const gd::Object& object);
+
   /**
    * \brief Called by RuntimeScene when creating the RuntimeObject from an
    * initial instance.
@@ -138,6 +215,26 @@ class GD_API RuntimeObject {
    */
   virtual bool Draw(sf::RenderTarget& renderTarget) { return true; };
 
+  /**
+   * \brief Draw the object, using \a batch if possible to group its draw call
+   * with the ones of the objects drawn before and after it.
+   *
+   * \note Default implementation draws the batch and then calls Draw.
+   * Objects that can be drawn as sprites should redefine it.
+   * \see SpriteBatch
+   */
+  virtual bool DrawInBatch(sf::RenderTarget& renderTarget, SpriteBatch& batch);
+
+  /**
+   * \brief Add to \a textures the textures used by the object.
+   *
+   * \note Default implementation adds nothing. Objects displaying textures
+   * of the image manager should redefine it.
+   * \see RuntimeScene::GetTexturesSize
+   */
+  virtual void GetUsedTextures(
+      std::vector<const SFMLTextureWrapper*>& textures) const {};
+
   /** \name Object's variables
    * Members functions providing access to the object's variables.
    */
@@ -173,20 +270,45 @@ class GD_API RuntimeObject {
   void DoBehaviorsPostEvents(RuntimeScene& scene);
 
   /**
-   * Only used by GD events generated code
+   * \brief Return the behaviors of the object, in the order of their names.
+   */
+  const std::vector<std::unique_ptr<gd::Behavior>>& GetAllBehaviors() const {
+    return behaviors;
+  }
+
+  /**
+   * \brief Return the behavior with the specified name, or NULL if the object
+   * has no such behavior.
    */
   gd::Behavior* GetBehaviorRawPointer(const gd::String& name);
 
   /**
-   * Only used by GD events generated code
+   * \brief Return the behavior with the specified name, or NULL if the object
+   * has no such behavior.
    */
   gd::Behavior* GetBehaviorRawPointer(const gd::String& name) const;
 
+  /**
+   * \brief Return the behavior of a slot, or NULL if the object has no such
+   * behavior. The index of the behavior is resolved again only if the object
+   * type is not the same as the last time the slot was used.
+   *
+   * Only used by GD events generated code
+   */
+  gd::Behavior* GetBehaviorRawPointer(RuntimeBehaviorSlot& slot) const {
+    if (slot.behaviorsNamesId != behaviorsNames->id) {
+      slot.index = behaviorsNames->GetIndex(slot.name);
+      slot.behaviorsNamesId = behaviorsNames->id;
+    }
+
+    return slot.index < behaviors.size() ? behaviors[slot.index].get() : NULL;
+  }
+
   /**
    * \brief Return true if the object has the behavior with the specified name.
    */
   virtual bool HasBehaviorNamed(const gd::String& name) const {
-    return behaviors.find(name) != behaviors.end();
+    return behaviorsNames->GetIndex(name) < behaviors.size();
   };
   ///@}
 
@@ -244,22 +366,33 @@ class GD_API RuntimeObject {
 
   /**
    * \brief Get the object AABB
+   * \note The reference is only valid until the next call to GetAABB.
    */
-  sf::FloatRect GetAABB() const;
+  virtual const sf::FloatRect& GetAABB() const;
+
+  /**
+   * \brief Return true if the object draws nothing outside its AABB, so that
+   * it can be skipped when its AABB is outside the area rendered by a camera.
+   *
+   * \note Default implementation returns false: objects must override this if
+   * their AABB covers everything they draw.
+   */
+  virtual bool IsDrawnInsideAABB() const { return false; }
 
   /**
    * \brief Get the object hitbox(es)
    * \note Default implementation returns a basic bounding box, according to the
    * object width/height and angle.
+   * \note The reference is only valid until the next call to GetHitBoxes.
    */
-  virtual std::vector<Polygon2d> GetHitBoxes() const;
+  virtual const std::vector<Polygon2d>& GetHitBoxes() const;
 
   /**
    * \brief Get the object hitbox(es) preferably intersecting with hint
    * \note The default implementation returns all the hitbox given by
    * GetHitBoxes()
    */
-  virtual std::vector<Polygon2d> GetHitBoxes(sf::FloatRect hint) const;
+  virtual const std::vector<Polygon2d>& GetHitBoxes(sf::FloatRect hint) const;
 
   /**
    * \brief Check collision between two objects using their hitboxes.
@@ -575,7 +708,7 @@ class GD_API RuntimeObject {
 
   void Duplicate(
       RuntimeScene& scene,
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists);
+      RuntimeObjectsLists pickedObjectLists);
   void ActivateBehavior(const gd::String& behaviorName, bool activate = true);
   bool BehaviorActivated(const gd::String& behaviorName);
 
@@ -586,18 +719,18 @@ class GD_API RuntimeObject {
   double GetDistanceWithObject(RuntimeObject* other);
 
   bool SeparateFromObjects(
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists,
+      RuntimeObjectsLists pickedObjectLists,
       bool ignoreTouchingEdges = false);
 
   /** \deprecated
    */
   void SeparateObjectsWithoutForces(
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists);
+      RuntimeObjectsLists pickedObjectLists);
 
   /** \deprecated
    */
   void SeparateObjectsWithForces(
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists);
+      RuntimeObjectsLists pickedObjectLists);
   ///@}
 
  protected:
@@ -610,18 +743,53 @@ class GD_API RuntimeObject {
                 ///< before another object.
   bool hidden;  ///< True to prevent the object from being rendered.
   gd::String layer;  ///< Name of the layer on which the object is.
-  std::map<gd::String, std::unique_ptr<gd::Behavior>>
+  std::vector<std::unique_ptr<gd::Behavior>>
       behaviors;  ///< Contains all behaviors of the object. Behaviors are the
                   ///< ownership of the object
+  std::shared_ptr<const RuntimeBehaviorsNames>
+      behaviorsNames;  ///< The names of the behaviors, shared by the objects
+                       ///< of the same type.
   RuntimeVariablesContainer
       objectVariables;        ///< List of the variables of the object
   std::vector<Force> forces;  ///< Forces applied to the object
 
+  mutable std::vector<Polygon2d>
+      hitBoxes;  ///< Storage for the hitboxes returned by GetHitBoxes.
+  mutable sf::FloatRect aabb;  ///< Storage for the AABB returned by GetAABB.
+
   /**
    * \brief Initialize object using another object. Used by copy-ctor and
    * assign-op. \warning Don't forget to update me if members were changed!
    */
   void Init(const RuntimeObject& object);
+
+ private:
+  friend class ObjInstancesHolder;
+  friend class RuntimeObjectsPool;
+  friend class RuntimeScene;
+
+  /**
+   * \brief Create the behaviors of the object from the behaviors of \a
+   * object.
+   */
+  void CreateBehaviors(RuntimeScene& scene, const gd::Object& object);
+
+  gd::String initialName;  ///< The name given to the object when it was
+                           ///< created, kept when it is deleted from the
+                           ///< scene (see RuntimeObjectsPool).
+
+  std::size_t instancesSlot;   ///< The slot of the object in the
+                               ///< ObjInstancesHolder containing it.
+  std::size_t instancesIndex;  ///< The position of the object in the list of
+                               ///< its slot.
+  std::size_t allObjectsIndex;  ///< The position of the object in the list of
+                                ///< all objects of the ObjInstancesHolder.
+  std::size_t renderedFrame;  ///< The frame of the RuntimeScene the object
+                              ///< was last put in a rendered list.
+  std::size_t renderedLayer;  ///< The index of the layer of the object in
+                              ///< its last rendered list.
+  std::size_t renderedIndex;  ///< The position of the object in its last
+                              ///< rendered list.
 };
 
 #endif  // RUNTIMEOBJECT_H
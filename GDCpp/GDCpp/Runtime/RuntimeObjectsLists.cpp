@@ -0,0 +1,56 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/RuntimeObjectsLists.h"
+#include <algorithm>
+
+constexpr std::size_t RuntimeObjectsLists::InlineCapacity;
+
+void RuntimeObjectsLists::Add(const gd::String &name,
+                              std::vector<RuntimeObject *> &list) {
+  for (value_type &entry : *this) {
+    if (entry.first == &name || *entry.first == name) {
+      entry.second = &list;
+      return;
+    }
+  }
+
+  if (count < InlineCapacity) {
+    inlineEntries[count] = value_type(&name, &list);
+  } else {
+    if (count == InlineCapacity)
+      moreEntries.assign(inlineEntries, inlineEntries + InlineCapacity);
+
+    moreEntries.push_back(value_type(&name, &list));
+  }
+  count++;
+
+  // Move the new entry to keep the entries sorted by name.
+  iterator position = std::upper_bound(
+      begin(), end() - 1, name, [](const gd::String &name,
+                                   const value_type &entry) {
+        return name < *entry.first;
+      });
+  std::rotate(position, end() - 1, end());
+}
+
+std::vector<RuntimeObject *> *RuntimeObjectsLists::Get(
+    const gd::String &name) const {
+  for (const value_type &entry : *this) {
+    if (entry.first == &name || *entry.first == name) return entry.second;
+  }
+
+  return NULL;
+}
+
+void RuntimeObjectsLists::Init(const RuntimeObjectsLists &other) {
+  count = other.count;
+  if (count <= InlineCapacity) {
+    std::copy(other.inlineEntries, other.inlineEntries + count, inlineEntries);
+    moreEntries.clear();
+  } else {
+    moreEntries = other.moreEntries;
+  }
+}
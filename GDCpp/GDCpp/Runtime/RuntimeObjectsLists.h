@@ -0,0 +1,95 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCPP_RUNTIMEOBJECTSLISTS_H
+#define GDCPP_RUNTIMEOBJECTSLISTS_H
+
+#include <utility>
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+class RuntimeObject;
+
+/**
+ * \brief The lists of objects, associated to their names, given to the
+ * functions called by events (for example, to pick objects).
+ *
+ * The lists are stored in a small flat array: up to InlineCapacity lists are
+ * stored without any allocation, so that the lists can be built and copied for
+ * each call made by events at almost no cost. Lists are iterated in the
+ * alphabetical order of their names, like the std::map previously used, so
+ * that the functions picking objects see them in the same order.
+ *
+ * \warning Names are not copied: they must outlive the RuntimeObjectsLists
+ * (events generated code uses the names stored in static RuntimeObjectSlot).
+ *
+ * \ingroup GameEngine
+ */
+class GD_API RuntimeObjectsLists {
+ public:
+  typedef std::pair<const gd::String *, std::vector<RuntimeObject *> *>
+      value_type;
+  typedef value_type *iterator;
+  typedef const value_type *const_iterator;
+
+  RuntimeObjectsLists() : count(0){};
+  RuntimeObjectsLists(const RuntimeObjectsLists &other) { Init(other); };
+  RuntimeObjectsLists &operator=(const RuntimeObjectsLists &other) {
+    if (&other != this) Init(other);
+    return *this;
+  };
+
+  /**
+   * \brief Add the list of the objects called \a name, or replace it if
+   * there is already a list for these objects.
+   * \note The list is inserted at the position keeping the lists sorted by
+   * name.
+   */
+  void Add(const gd::String &name, std::vector<RuntimeObject *> &list);
+  void Add(gd::String &&name, std::vector<RuntimeObject *> &list) = delete;
+
+  /**
+   * \brief Return the list of the objects called \a name, or NULL if there is
+   * no list for these objects.
+   */
+  std::vector<RuntimeObject *> *Get(const gd::String &name) const;
+
+  /**
+   * \brief Remove all the lists.
+   */
+  void clear() {
+    count = 0;
+    moreEntries.clear();
+  };
+
+  std::size_t size() const { return count; };
+  bool empty() const { return count == 0; };
+
+  iterator begin() { return GetEntries(); };
+  iterator end() { return GetEntries() + count; };
+  const_iterator begin() const { return GetEntries(); };
+  const_iterator end() const { return GetEntries() + count; };
+  const_iterator cbegin() const { return begin(); };
+  const_iterator cend() const { return end(); };
+
+  static constexpr std::size_t InlineCapacity = 8;
+
+ private:
+  void Init(const RuntimeObjectsLists &other);
+
+  value_type *GetEntries() {
+    return count <= InlineCapacity ? inlineEntries : moreEntries.data();
+  };
+  const value_type *GetEntries() const {
+    return count <= InlineCapacity ? inlineEntries : moreEntries.data();
+  };
+
+  std::size_t count;
+  value_type inlineEntries[InlineCapacity];  ///< The entries, when there are
+                                             ///< at most InlineCapacity.
+  std::vector<value_type> moreEntries;       ///< The entries, when there are
+                                             ///< more than InlineCapacity.
+};
+
+#endif  // GDCPP_RUNTIMEOBJECTSLISTS_H
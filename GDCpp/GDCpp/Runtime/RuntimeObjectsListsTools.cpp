@@ -5,6 +5,7 @@
  */
 #include "RuntimeObjectsListsTools.h"
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include "RuntimeObject.h"
@@ -17,6 +18,90 @@ void GD_API PickOnly(RuntimeObjectsLists& pickedObjectsLists,
     if (it->second != NULL) it->second->clear();
   }
 
-  if (pickedObjectsLists[thisOne->GetName()] != NULL)
-    pickedObjectsLists[thisOne->GetName()]->push_back(thisOne);
+  std::vector<RuntimeObject*>* list =
+      pickedObjectsLists.Get(thisOne->GetName());
+  if (list != NULL) list->push_back(thisOne);
+}
+
+namespace {
+/**
+ * Buffers of the PickedObjectsFlags not in use. Buffers are given back in the
+ * reverse order they were taken, so nested tests reuse the same buffers.
+ *
+ * Each thread has its own pool, as objects can be picked by several threads
+ * (scenes loaded in background, behaviors run in parallel).
+ */
+thread_local std::vector<std::unique_ptr<PickedObjectsFlags::Buffers> >
+    buffersPool;
+
+/**
+ * Buffers of the ObjectsBoundsGrid not in use, for each thread.
+ */
+thread_local std::vector<std::unique_ptr<ObjectsBoundsGrid::Buffers> >
+    gridsPool;
+}  // namespace
+
+PickedObjectsFlags::PickedObjectsFlags(
+    const RuntimeObjectsLists& objectsLists) {
+  if (buffersPool.empty()) {
+    buffers = new Buffers;
+  } else {
+    buffers = buffersPool.back().release();
+    buffersPool.pop_back();
+  }
+
+  std::size_t count = 0;
+  buffers->offsets.clear();
+  for (auto it = objectsLists.cbegin(); it != objectsLists.cend(); ++it) {
+    buffers->offsets.push_back(count);
+    if (it->second) count += it->second->size();
+  }
+  buffers->offsets.push_back(count);
+  buffers->flags.assign(count, false);
+}
+
+PickedObjectsFlags::~PickedObjectsFlags() {
+  buffersPool.push_back(std::unique_ptr<Buffers>(buffers));
+}
+
+ObjectsBoundsGrid::ObjectsBoundsGrid() {
+  if (gridsPool.empty()) {
+    buffers = new Buffers;
+  } else {
+    buffers = gridsPool.back().release();
+    gridsPool.pop_back();
+  }
+
+  buffers->entries.clear();
+}
+
+ObjectsBoundsGrid::~ObjectsBoundsGrid() {
+  gridsPool.push_back(std::unique_ptr<Buffers>(buffers));
+}
+
+void PickedObjectsFlags::TrimNotPickedObjects(
+    const RuntimeObjectsLists& objectsLists) const {
+  std::size_t i = 0;
+  for (RuntimeObjectsLists::const_iterator it = objectsLists.begin();
+       it != objectsLists.end();
+       ++it, ++i) {
+    if (!it->second) continue;
+    std::vector<RuntimeObject*>& arr = *it->second;
+
+    //*This is important*! We can have a list that has already been trimmed
+    // just before (when the same list is in the first and second lists of
+    // TwoObjectListsTest).
+    const std::size_t offset = buffers->offsets[i];
+    if (arr.size() != buffers->offsets[i + 1] - offset) continue;
+
+    size_t finalSize = 0;
+    for (std::size_t k = 0; k < arr.size(); ++k) {
+      RuntimeObject* obj = arr[k];
+      if (buffers->flags[offset + k]) {
+        arr[finalSize] = obj;
+        finalSize++;
+      }
+    }
+    arr.resize(finalSize);
+  }
 }
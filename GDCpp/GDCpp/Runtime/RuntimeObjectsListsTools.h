@@ -6,14 +6,15 @@
 #ifndef OBJECTSLISTSTOOLS_H
 #define OBJECTSLISTSTOOLS_H
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <string>
 #include <vector>
 #include "RuntimeObject.h"
+#include "RuntimeObjectsLists.h"
 #include "RuntimeScene.h"
-
-typedef std::map<gd::String, std::vector<RuntimeObject *> *>
-    RuntimeObjectsLists;
+#include "SpatialHashGrid.h"
 
 /**
  * \brief Keep only the specified object in the lists of picked objects.
@@ -24,6 +25,97 @@ typedef std::map<gd::String, std::vector<RuntimeObject *> *>
 void GD_API PickOnly(RuntimeObjectsLists &pickedObjectsLists,
                      RuntimeObject *thisOne);
 
+/**
+ * \brief A flag for each object of lists of objects, used to remember which
+ * objects are picked.
+ *
+ * Flags are stored in a flat bitset, borrowed from a pool of buffers and given
+ * back when the PickedObjectsFlags is destroyed: picking objects does not
+ * allocate memory once the buffers are large enough. Each thread has its own
+ * pool, so PickedObjectsFlags can be used by several threads.
+ *
+ * \ingroup GameEngine
+ */
+class GD_API PickedObjectsFlags {
+ public:
+  /**
+   * \brief Create a flag, not set, for each object of the lists.
+   */
+  PickedObjectsFlags(const RuntimeObjectsLists &objectsLists);
+  ~PickedObjectsFlags();
+
+  bool IsPicked(std::size_t list, std::size_t index) const {
+    return buffers->flags[buffers->offsets[list] + index];
+  }
+
+  void Pick(std::size_t list, std::size_t index) {
+    buffers->flags[buffers->offsets[list] + index] = true;
+  }
+
+  /**
+   * \brief Remove from the lists the objects that are not picked.
+   *
+   * Lists that do not have the same size as when the flags were created are
+   * considered as already trimmed and are left untouched.
+   */
+  void TrimNotPickedObjects(const RuntimeObjectsLists &objectsLists) const;
+
+  struct Buffers {
+    std::vector<bool> flags;  ///< The flags of all the objects.
+    std::vector<std::size_t>
+        offsets;  ///< The position of the first flag of each list, followed
+                  ///< by the total number of flags.
+  };
+
+ private:
+  PickedObjectsFlags(const PickedObjectsFlags &) = delete;
+  PickedObjectsFlags &operator=(const PickedObjectsFlags &) = delete;
+
+  Buffers *buffers;
+};
+
+/**
+ * \brief The bounds of the objects of lists of objects, stored in a
+ * SpatialHashGrid.
+ *
+ * Like PickedObjectsFlags, the entries and the grid are borrowed from a pool
+ * and given back when the ObjectsBoundsGrid is destroyed, so that they don't
+ * allocate memory once they are large enough.
+ *
+ * \see TwoObjectListsTest
+ * \ingroup GameEngine
+ */
+class GD_API ObjectsBoundsGrid {
+ public:
+  /**
+   * \brief Borrow empty entries and grid from the pool.
+   */
+  ObjectsBoundsGrid();
+  ~ObjectsBoundsGrid();
+
+  struct Entry {
+    std::size_t list;
+    std::size_t index;
+    RuntimeObject *const *object;
+    sf::FloatRect bounds;
+  };
+
+  std::vector<Entry> &GetEntries() { return buffers->entries; }
+  SpatialHashGrid &GetGrid() { return buffers->grid; }
+
+  struct Buffers {
+    std::vector<Entry> entries;  ///< The objects, with their bounds.
+    SpatialHashGrid grid;  ///< The bounds of the entries, stored at the same
+                           ///< index.
+  };
+
+ private:
+  ObjectsBoundsGrid(const ObjectsBoundsGrid &) = delete;
+  ObjectsBoundsGrid &operator=(const ObjectsBoundsGrid &) = delete;
+
+  Buffers *buffers;
+};
+
 /**
  * \brief Filter objects to keep only the one that fullfil the predicate
  *
@@ -42,16 +134,7 @@ bool PickObjectsIf(const RuntimeObjectsLists &pickedObjectsLists,
                    bool negatePredicate,
                    Pred predicate) {
   bool isTrue = false;
-
-  // Create a boolean for each object
-  std::vector<std::vector<bool> > pickedList;
-  for (RuntimeObjectsLists::const_iterator it = pickedObjectsLists.begin();
-       it != pickedObjectsLists.end();
-       ++it) {
-    std::vector<bool> arr;
-    arr.assign(it->second->size(), false);
-    pickedList.push_back(arr);
-  }
+  PickedObjectsFlags pickedFlags(pickedObjectsLists);
 
   // Pick objects which are fulfulling the predicate.
   std::size_t i = 0;
@@ -63,30 +146,13 @@ bool PickObjectsIf(const RuntimeObjectsLists &pickedObjectsLists,
 
     for (std::size_t k = 0; k < arr1.size(); ++k) {
       if (negatePredicate ^ predicate(arr1[k])) {
-        pickedList[i][k] = true;
+        pickedFlags.Pick(i, k);
         isTrue = true;
       }
     }
   }
 
-  // Trim not picked objects from lists.
-  i = 0;
-  for (RuntimeObjectsLists::const_iterator it = pickedObjectsLists.begin();
-       it != pickedObjectsLists.end();
-       ++it, ++i) {
-    size_t finalSize = 0;
-    if (!it->second) continue;
-    std::vector<RuntimeObject *> &arr = *it->second;
-
-    for (std::size_t k = 0; k < arr.size(); ++k) {
-      RuntimeObject *obj = arr[k];
-      if (pickedList[i][k]) {
-        arr[finalSize] = obj;
-        finalSize++;
-      }
-    }
-    arr.resize(finalSize);
-  }
+  pickedFlags.TrimNotPickedObjects(pickedObjectsLists);
 
   return isTrue;
 }
@@ -107,43 +173,26 @@ bool PickObjectsIf(const RuntimeObjectsLists &pickedObjectsLists,
  * when trimming the list).
  *
  * Cost (Worst case, predicate being always false):
- *    Cost(Creating tables with a total of NbObjList1+NbObjList2 booleans)
+ *    Cost(Clearing NbObjList1+NbObjList2 flags)
  *  + Cost(predicate)*NbObjList1*NbObjList2
  *  + Cost(Testing NbObjList1+NbObjList2 booleans)
  *  + Cost(Removing NbObjList1+NbObjList2 objects from all the lists)
  *
  * Cost (Best case, predicate being always true):
- *    Cost(Creating tables with a total of NbObjList1+NbObjList2 booleans)
+ *    Cost(Clearing NbObjList1+NbObjList2 flags)
  *  + Cost(predicate)*(NbObjList1+NbObjList2)
  *  + Cost(Testing NbObjList1+NbObjList2 booleans)
  *
  * \ingroup GameEngine
  */
 template <typename Pred>
-bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
-                        RuntimeObjectsLists objectsLists2,
+bool TwoObjectListsTest(const RuntimeObjectsLists &objectsLists1,
+                        const RuntimeObjectsLists &objectsLists2,
                         bool negatePredicate,
                         Pred predicate) {
   bool isTrue = false;
-
-  // Create a boolean for each object
-  std::vector<std::vector<bool> > pickedList1;
-  std::vector<std::vector<bool> > pickedList2;
-
-  for (RuntimeObjectsLists::const_iterator it = objectsLists1.begin();
-       it != objectsLists1.end();
-       ++it) {
-    std::vector<bool> arr;
-    arr.assign(it->second->size(), false);
-    pickedList1.push_back(arr);
-  }
-  for (RuntimeObjectsLists::const_iterator it = objectsLists2.begin();
-       it != objectsLists2.end();
-       ++it) {
-    std::vector<bool> arr;
-    arr.assign(it->second->size(), false);
-    pickedList2.push_back(arr);
-  }
+  PickedObjectsFlags pickedFlags1(objectsLists1);
+  PickedObjectsFlags pickedFlags2(objectsLists2);
 
   // Launch the function each object of the first list with each object
   // of the second list.
@@ -165,7 +214,7 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
         const std::vector<RuntimeObject *> &arr2 = *it2->second;
 
         for (std::size_t l = 0; l < arr2.size(); ++l) {
-          if (pickedList1[i][k] && pickedList2[j][l])
+          if (pickedFlags1.IsPicked(i, k) && pickedFlags2.IsPicked(j, l))
             continue;  // Avoid unnecessary costly call to functor.
 
           if (std::addressof(arr1[k]) != std::addressof(arr2[l]) &&
@@ -174,8 +223,8 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
               isTrue = true;
 
               // Pick the objects
-              pickedList1[i][k] = true;
-              pickedList2[j][l] = true;
+              pickedFlags1.Pick(i, k);
+              pickedFlags2.Pick(j, l);
             }
 
             atLeastOneObject = true;
@@ -186,57 +235,127 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
       if (!atLeastOneObject &&
           negatePredicate) {  // The object is not overlapping any other object.
         isTrue = true;
-        pickedList1[i][k] = true;
+        pickedFlags1.Pick(i, k);
       }
     }
   }
 
-  // Trim not picked objects from lists.
-  i = 0;
+  pickedFlags1.TrimNotPickedObjects(objectsLists1);
+  if (!negatePredicate) pickedFlags2.TrimNotPickedObjects(objectsLists2);
+
+  return isTrue;
+}
+
+/**
+ * \brief Picks objects that fullfil the predicate with at least another object,
+ * only calling the predicate for objects with overlapping bounds.
+ *
+ * This is the same as TwoObjectListsTest, but objects of objectsLists2 are
+ * first stored in a SpatialHashGrid: for each object of objectsLists1, the
+ * predicate is only called with the objects having bounds overlapping its own
+ * bounds. The bounds must be computed so that the predicate is always false
+ * when they are not overlapping.
+ *
+ * When the lists are small, all pairs are tested as building the grid would
+ * be more costly than calling the predicate.
+ *
+ * Cost (Objects evenly spread):
+ *    Cost(bounds)*(NbObjList1+NbObjList2)
+ *  + Cost(predicate)*(Number of pairs with overlapping bounds)
+ *
+ * \ingroup GameEngine
+ */
+template <typename Bounds, typename Pred>
+bool TwoObjectListsTest(const RuntimeObjectsLists &objectsLists1,
+                        const RuntimeObjectsLists &objectsLists2,
+                        bool negatePredicate,
+                        Bounds bounds,
+                        Pred predicate) {
+  std::size_t objectsCount1 = 0;
+  std::size_t objectsCount2 = 0;
+  for (auto it = objectsLists1.cbegin(); it != objectsLists1.cend(); ++it)
+    if (it->second) objectsCount1 += it->second->size();
+  for (auto it = objectsLists2.cbegin(); it != objectsLists2.cend(); ++it)
+    if (it->second) objectsCount2 += it->second->size();
+
+  if (objectsCount1 < 8 || objectsCount2 < 8)
+    return TwoObjectListsTest(
+        objectsLists1, objectsLists2, negatePredicate, predicate);
+
+  // Store the bounds of the objects of the second lists in a grid,
+  // with cells of the average size of the objects.
+  typedef ObjectsBoundsGrid::Entry Entry;
+  ObjectsBoundsGrid boundsGrid;
+  std::vector<Entry> &entries = boundsGrid.GetEntries();
+  float sizesSum = 0;
+
+  std::size_t j = 0;
+  for (RuntimeObjectsLists::const_iterator it2 = objectsLists2.begin();
+       it2 != objectsLists2.end();
+       ++it2, ++j) {
+    if (!it2->second) continue;
+    const std::vector<RuntimeObject *> &arr2 = *it2->second;
+
+    for (std::size_t l = 0; l < arr2.size(); ++l) {
+      sf::FloatRect objectBounds = bounds(arr2[l]);
+      entries.push_back(Entry{j, l, &arr2[l], objectBounds});
+      if (std::isfinite(objectBounds.width) &&
+          std::isfinite(objectBounds.height))
+        sizesSum += std::max(objectBounds.width, objectBounds.height);
+    }
+  }
+
+  SpatialHashGrid &grid = boundsGrid.GetGrid();
+  grid.Reset(sizesSum / entries.size());
+  for (const Entry &entry : entries) grid.Insert(entry.bounds);
+
+  PickedObjectsFlags pickedFlags1(objectsLists1);
+  PickedObjectsFlags pickedFlags2(objectsLists2);
+
+  // Launch the function each object of the first list with each object
+  // of the second list having overlapping bounds.
+  bool isTrue = false;
+  std::size_t i = 0;
   for (RuntimeObjectsLists::const_iterator it = objectsLists1.begin();
        it != objectsLists1.end();
        ++it, ++i) {
-    size_t finalSize = 0;
     if (!it->second) continue;
-    std::vector<RuntimeObject *> &arr = *it->second;
+    const std::vector<RuntimeObject *> &arr1 = *it->second;
 
-    for (std::size_t k = 0; k < arr.size(); ++k) {
-      RuntimeObject *obj = arr[k];
-      if (pickedList1[i][k]) {
-        arr[finalSize] = obj;
-        finalSize++;
-      }
-    }
-    arr.resize(finalSize);
-  }
+    for (std::size_t k = 0; k < arr1.size(); ++k) {
+      bool atLeastOneObject = false;
+
+      grid.ForEachOverlapping(bounds(arr1[k]), [&](std::size_t id) {
+        const Entry &entry = entries[id];
+        if (pickedFlags1.IsPicked(i, k) &&
+            pickedFlags2.IsPicked(entry.list, entry.index))
+          return;  // Avoid unnecessary costly call to functor.
+
+        if (std::addressof(arr1[k]) != entry.object &&
+            predicate(arr1[k], *entry.object)) {
+          if (!negatePredicate) {
+            isTrue = true;
+
+            // Pick the objects
+            pickedFlags1.Pick(i, k);
+            pickedFlags2.Pick(entry.list, entry.index);
+          }
 
-  if (!negatePredicate) {
-    std::size_t i = 0;
-    for (RuntimeObjectsLists::const_iterator it = objectsLists2.begin();
-         it != objectsLists2.end();
-         ++it, ++i) {
-      size_t finalSize = 0;
-      if (!it->second) continue;
-      std::vector<RuntimeObject *> &arr = *it->second;
-
-      //*This is important*! We can have a list that has already been trimmed
-      // just before
-      if (arr.size() !=
-          pickedList2[i].size())  // If the size of the objects list != size of
-                                  // the boolean "picked" list...
-        continue;  //... then the object list was already trimmed, skip it.
-
-      for (std::size_t k = 0; k < arr.size(); ++k) {
-        RuntimeObject *obj = arr[k];
-        if (pickedList2[i][k]) {
-          arr[finalSize] = obj;
-          finalSize++;
+          atLeastOneObject = true;
         }
+      });
+
+      if (!atLeastOneObject &&
+          negatePredicate) {  // The object is not overlapping any other object.
+        isTrue = true;
+        pickedFlags1.Pick(i, k);
       }
-      arr.resize(finalSize);
     }
   }
 
+  pickedFlags1.TrimNotPickedObjects(objectsLists1);
+  if (!negatePredicate) pickedFlags2.TrimNotPickedObjects(objectsLists2);
+
   return isTrue;
 }
 #endif
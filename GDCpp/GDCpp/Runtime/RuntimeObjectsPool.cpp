@@ -0,0 +1,57 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/RuntimeObjectsPool.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Extensions/CppPlatform.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+
+RuntimeObjectsPool::RuntimeObjectsPool() : maxObjectsCount(1024) {}
+
+std::unique_ptr<RuntimeObject> RuntimeObjectsPool::CreateObject(
+    RuntimeScene& scene, gd::Object& object) {
+  std::unique_ptr<RuntimeObject> runtimeObject;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = recycledObjects.find(object.GetName());
+    if (it != recycledObjects.end() && !it->second.empty()) {
+      runtimeObject = std::move(it->second.back());
+      it->second.pop_back();
+    }
+  }
+  if (!runtimeObject)
+    return CppPlatform::Get().CreateRuntimeObject(scene, object);
+
+  runtimeObject->Reset(scene, object);
+  return runtimeObject;
+}
+
+void RuntimeObjectsPool::Recycle(std::unique_ptr<RuntimeObject> object) {
+  if (!object || !object->CanBeRecycled()) return;
+
+  // Behaviors can hold resources shared with the scene (for example, the
+  // platforms known by the platformer objects): destroy them now rather than
+  // when the object is reused.
+  object->behaviors.clear();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  std::vector<std::unique_ptr<RuntimeObject>>& objects =
+      recycledObjects[object->initialName];
+  if (objects.size() >= maxObjectsCount) return;
+
+  objects.push_back(std::move(object));
+}
+
+void RuntimeObjectsPool::Clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  recycledObjects.clear();
+}
+
+std::size_t RuntimeObjectsPool::GetRecycledObjectsCount(
+    const gd::String& name) const {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = recycledObjects.find(name);
+  return it != recycledObjects.end() ? it->second.size() : 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCPP_RUNTIMEOBJECTSPOOL_H
+#define GDCPP_RUNTIMEOBJECTSPOOL_H
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "GDCpp/Runtime/String.h"
+class RuntimeObject;
+class RuntimeScene;
+namespace gd {
+class Object;
+}
+
+/**
+ * \brief Keep the objects deleted from a scene so that they can be reused when
+ * objects of the same name are created, instead of being destroyed and
+ * allocated again.
+ *
+ * Only the objects returning true in RuntimeObject::CanBeRecycled are kept:
+ * they are reset with RuntimeObject::Reset when they are reused.
+ *
+ * The pool can be used by several threads (behaviors run in parallel can
+ * create objects, see gd::Behavior::CanStepInParallel).
+ *
+ * \see RuntimeScene::GetObjectsPool
+ */
+class GD_API RuntimeObjectsPool {
+ public:
+  RuntimeObjectsPool();
+
+  /**
+   * \brief Create a RuntimeObject from \a object, reusing a recycled object of
+   * the same name if there is one.
+   *
+   * \return The new object, or an empty pointer if the object can't be
+   * created.
+   */
+  std::unique_ptr<RuntimeObject> CreateObject(RuntimeScene& scene,
+                                              gd::Object& object);
+
+  /**
+   * \brief Keep \a object to reuse it later, or destroy it if it can't be
+   * recycled (or if enough objects of the same name are already kept).
+   *
+   * The behaviors of the object are destroyed immediately.
+   */
+  void Recycle(std::unique_ptr<RuntimeObject> object);
+
+  /**
+   * \brief Destroy all the objects kept by the pool.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the number of objects kept for the objects named \a name.
+   */
+  std::size_t GetRecycledObjectsCount(const gd::String& name) const;
+
+  /**
+   * \brief Set the maximum number of objects kept for each object name.
+   */
+  void SetMaxObjectsCount(std::size_t count) { maxObjectsCount = count; }
+
+  /**
+   * \brief Get the maximum number of objects kept for each object name.
+   */
+  std::size_t GetMaxObjectsCount() const { return maxObjectsCount; }
+
+ private:
+  std::unordered_map<gd::String, std::vector<std::unique_ptr<RuntimeObject>>>
+      recycledObjects;  ///< The objects kept, for each object name.
+  std::size_t maxObjectsCount;  ///< The maximum number of objects kept for
+                                ///< each object name.
+  mutable std::mutex mutex;     ///< Protects recycledObjects.
+};
+
+#endif  // GDCPP_RUNTIMEOBJECTSPOOL_H
@@ -8,6 +8,7 @@
 #endif
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
@@ -30,6 +31,8 @@
 #include "GDCpp/Runtime/RuntimeObjectHelpers.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
 #include "GDCpp/Runtime/SoundManager.h"
+#include "GDCpp/Runtime/SpatialHashGrid.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
 #include "GDCpp/Runtime/profile.h"
 #if !defined(ANDROID)  // TODO: OpenGL
 #include "GDCpp/Runtime/Tools/OpenGLTools.h"
@@ -58,23 +61,31 @@ RuntimeScene::RuntimeScene(sf::RenderWindow* renderWindow_, RuntimeGame* game_)
 #endif
       isFullScreen(false),
       inputManager(renderWindow_),
-      codeExecutionEngine(new CodeExecutionEngine) {
+      codeExecutionEngine(new CodeExecutionEngine),
+      renderedFrame(0),
+      drawnObjectsCount(0),
+      culledObjectsCount(0),
+      loadingFinished(false) {
   ChangeRenderWindow(renderWindow);
 }
 
 RuntimeScene::~RuntimeScene() {
-  for (std::size_t i = 0; i < game->GetUsedExtensions().size(); ++i) {
-    std::shared_ptr<gd::PlatformExtension> gdExtension =
-        CppPlatform::Get().GetExtension(game->GetUsedExtensions()[i]);
-    std::shared_ptr<ExtensionBase> extension =
-        std::dynamic_pointer_cast<ExtensionBase>(gdExtension);
-    if (extension != std::shared_ptr<ExtensionBase>())
-      extension->SceneUnloaded(*this);
+  // Extensions were not notified of the loading of a scene only preloaded.
+  if (loadingFinished) {
+    for (std::size_t i = 0; i < game->GetUsedExtensions().size(); ++i) {
+      std::shared_ptr<gd::PlatformExtension> gdExtension =
+          CppPlatform::Get().GetExtension(game->GetUsedExtensions()[i]);
+      std::shared_ptr<ExtensionBase> extension =
+          std::dynamic_pointer_cast<ExtensionBase>(gdExtension);
+      if (extension != std::shared_ptr<ExtensionBase>())
+        extension->SceneUnloaded(*this);
+    }
   }
 
   objectsInstances.Clear();  // Force destroy objects NOW as they can have
                              // pointers to some RuntimeScene members which so
                              // need to be destroyed AFTER objects.
+  objectsPool.Clear();
 }
 
 std::shared_ptr<gd::ImageManager> RuntimeScene::GetImageManager() const {
@@ -122,6 +133,7 @@ void RuntimeScene::RequestChange(SceneChange::Change change,
 
 bool RuntimeScene::RenderAndStep() {
   requestedChange.change = SceneChange::CONTINUE;
+  requestedPreload.clear();
   ManageRenderTargetEvents();
   timeManager.Update(clock.restart().asMicroseconds(), game->GetMinimumFPS());
   ManageObjectsBeforeEvents();
@@ -157,6 +169,8 @@ bool RuntimeScene::RenderAndStep() {
   if (GetProfiler() && GetProfiler()->profilingActivated) {
     GetProfiler()->lastRenderingTime =
         GetProfiler()->renderingClock.getTimeMicroseconds();
+    GetProfiler()->lastDrawnObjectsCount = drawnObjectsCount;
+    GetProfiler()->lastCulledObjectsCount = culledObjectsCount;
     GetProfiler()->totalSceneTime +=
         GetProfiler()->lastRenderingTime + GetProfiler()->lastEventsTime;
     GetProfiler()->totalEventsTime += GetProfiler()->lastEventsTime;
@@ -204,9 +218,9 @@ void RuntimeScene::Render() {
                                 GetBackgroundColorGreen(),
                                 GetBackgroundColorBlue()));
 
-  // Sort object by order to render them
-  RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
-  OrderObjectsByZOrder(allObjects);
+  UpdateRenderedObjects();
+  drawnObjectsCount = 0;
+  culledObjectsCount = 0;
 
 #if !defined(ANDROID)  // TODO: OpenGL
   // To allow using OpenGL to draw:
@@ -251,11 +265,23 @@ void RuntimeScene::Render() {
         // Prepare SFML rendering
         renderWindow->setView(camera.GetSFMLView());
 
-        // Rendering all objects
-        for (std::size_t id = 0; id < allObjects.size(); ++id) {
-          if (allObjects[id]->GetLayer() == layers[layerIndex].GetName())
-            allObjects[id]->Draw(*renderWindow);
+        // Rendering the objects of the layer visible by the camera
+        const sf::FloatRect visibleArea = camera.GetVisibleArea();
+        const RuntimeObjNonOwningPtrList& layerObjects =
+            renderedLayersObjects[layerIndex];
+        for (std::size_t id = 0; id < layerObjects.size(); ++id) {
+          RuntimeObject* object = layerObjects[id];
+          if (object->IsDrawnInsideAABB() &&
+              !SpatialHashGrid::AreOverlapping(object->GetAABB(),
+                                               visibleArea)) {
+            culledObjectsCount++;
+            continue;
+          }
+
+          object->DrawInBatch(*renderWindow, spriteBatch);
+          drawnObjectsCount++;
         }
+        spriteBatch.Flush(*renderWindow);
       }
     }
   }
@@ -268,23 +294,121 @@ void RuntimeScene::Render() {
   renderWindow->display();
 }
 
+void RuntimeScene::UpdateRenderedObjects() {
+  if (renderedLayersObjects.size() != layers.size()) {
+    renderedLayersObjects.assign(layers.size(), RuntimeObjNonOwningPtrList());
+    addedLayersObjects.assign(layers.size(), RuntimeObjNonOwningPtrList());
+  }
+
+  // Empty the positions of the lists without changing their sizes: objects
+  // rendered at the previous frame are put back at their position (the
+  // objects of the lists are never accessed, as they may have been deleted).
+  for (std::size_t i = 0; i < renderedLayersObjects.size(); ++i)
+    std::fill(renderedLayersObjects[i].begin(),
+              renderedLayersObjects[i].end(),
+              nullptr);
+
+  std::size_t previousFrame = renderedFrame;
+  ++renderedFrame;
+
+  const RuntimeObjNonOwningPtrList& sceneObjects =
+      objectsInstances.GetAllObjects();
+  std::size_t objectLayerIndex = layers.size();
+  for (std::size_t id = 0; id < sceneObjects.size(); ++id) {
+    RuntimeObject* object = sceneObjects[id];
+
+    if (object->renderedFrame == previousFrame &&
+        object->renderedLayer < layers.size()) {
+      RuntimeObjNonOwningPtrList& layerObjects =
+          renderedLayersObjects[object->renderedLayer];
+      if (object->renderedIndex < layerObjects.size() &&
+          layerObjects[object->renderedIndex] == nullptr &&
+          object->GetLayer() == layers[object->renderedLayer].GetName()) {
+        layerObjects[object->renderedIndex] = object;
+        continue;
+      }
+    }
+
+    // Objects are often on the same layer as the previous one.
+    if (objectLayerIndex >= layers.size() ||
+        object->GetLayer() != layers[objectLayerIndex].GetName()) {
+      for (objectLayerIndex = 0; objectLayerIndex < layers.size();
+           ++objectLayerIndex) {
+        if (object->GetLayer() == layers[objectLayerIndex].GetName()) break;
+      }
+    }
+
+    if (objectLayerIndex < layers.size())
+      addedLayersObjects[objectLayerIndex].push_back(object);
+  }
+
+  for (std::size_t layerIndex = 0; layerIndex < layers.size(); ++layerIndex) {
+    // Remove the deleted objects (keeping the order of the others) and add
+    // the new ones at the end.
+    RuntimeObjNonOwningPtrList& layerObjects =
+        renderedLayersObjects[layerIndex];
+    RuntimeObjNonOwningPtrList& addedObjects = addedLayersObjects[layerIndex];
+    layerObjects.erase(
+        std::remove(layerObjects.begin(), layerObjects.end(), nullptr),
+        layerObjects.end());
+    layerObjects.insert(
+        layerObjects.end(), addedObjects.begin(), addedObjects.end());
+    addedObjects.clear();
+
+    OrderObjectsByZOrder(layerObjects);
+    for (std::size_t i = 0; i < layerObjects.size(); ++i) {
+      layerObjects[i]->renderedFrame = renderedFrame;
+      layerObjects[i]->renderedLayer = layerIndex;
+      layerObjects[i]->renderedIndex = i;
+    }
+  }
+}
+
 bool RuntimeScene::OrderObjectsByZOrder(RuntimeObjNonOwningPtrList& objList) {
-  if (StandardSortMethod())
-    std::sort(objList.begin(),
-              objList.end(),
-              [](const RuntimeObject* o1, const RuntimeObject* o2) {
-                return o1->GetZOrder() < o2->GetZOrder();
-              });
-  else
-    std::stable_sort(objList.begin(),
-                     objList.end(),
-                     [](const RuntimeObject* o1, const RuntimeObject* o2) {
-                       return o1->GetZOrder() < o2->GetZOrder();
-                     });
+  auto isBefore = [](const RuntimeObject* o1, const RuntimeObject* o2) {
+    return o1->GetZOrder() < o2->GetZOrder();
+  };
+
+  // Insertion sort, which is linear on nearly sorted lists and keeps the order
+  // of objects with the same Z order. When too many objects must be moved, the
+  // rest of the list is sorted with the sort method of the scene.
+  std::size_t movesBudget = objList.size() * 8;
+  for (std::size_t i = 1; i < objList.size(); ++i) {
+    RuntimeObject* object = objList[i];
+    std::size_t j = i;
+    for (; j > 0 && isBefore(object, objList[j - 1]) && movesBudget > 0;
+         --j, --movesBudget)
+      objList[j] = objList[j - 1];
+    objList[j] = object;
+
+    if (movesBudget == 0) {
+      if (StandardSortMethod())
+        std::sort(objList.begin(), objList.end(), isBefore);
+      else
+        std::stable_sort(objList.begin(), objList.end(), isBefore);
+      break;
+    }
+  }
 
   return true;
 }
 
+std::size_t RuntimeScene::GetTexturesSize() const {
+  std::vector<const SFMLTextureWrapper*> textures;
+  for (const RuntimeObject* object : objectsInstances.GetAllObjects())
+    object->GetUsedTextures(textures);
+
+  std::sort(textures.begin(), textures.end());
+  textures.erase(std::unique(textures.begin(), textures.end()),
+                 textures.end());
+
+  std::size_t size = 0;
+  for (const SFMLTextureWrapper* texture : textures)
+    size += gd::ImageManager::GetTextureSize(*texture);
+
+  return size;
+}
+
 RuntimeLayer& RuntimeScene::GetRuntimeLayer(const gd::String& name) {
   for (RuntimeLayer& layer : layers) {
     if (layer.GetName() == name) return layer;
@@ -303,24 +427,26 @@ const RuntimeLayer& RuntimeScene::GetRuntimeLayer(
 }
 
 void RuntimeScene::ManageObjectsAfterEvents() {
-  // Delete objects that were removed.
-  RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
-  for (std::size_t id = 0; id < allObjects.size(); ++id) {
-    if (allObjects[id]->GetName().empty()) {
-      for (std::size_t i = 0; i < extensionsToBeNotifiedOnObjectDeletion.size();
-           ++i)
-        extensionsToBeNotifiedOnObjectDeletion[i]->ObjectDeletedFromScene(
-            *this, allObjects[id]);
-
-      objectsInstances.RemoveObject(
-          allObjects[id]);  // Remove from objects instances, not from the
-                            // temporary list!
-    }
+  // Delete objects that were removed: they were all moved to the deleted
+  // objects slot when their name was cleared, and are kept in the pool to be
+  // reused by the objects created later.
+  const RuntimeObjNonOwningPtrList& deletedObjects =
+      objectsInstances.GetObjectsRawPointers(
+          objectsInstances.GetDeletedObjectsSlot());
+  for (std::size_t id = 0; id < deletedObjects.size(); ++id) {
+    for (std::size_t i = 0; i < extensionsToBeNotifiedOnObjectDeletion.size();
+         ++i)
+      extensionsToBeNotifiedOnObjectDeletion[i]->ObjectDeletedFromScene(
+          *this, deletedObjects[id]);
   }
-
-  // Update objects positions, forces and behaviors
-  allObjects = objectsInstances.GetAllObjects();
-  for (RuntimeObject* object : allObjects) {
+  objectsInstances.FlushDeletedObjects(objectsPool);
+
+  // Update objects positions, forces and behaviors. Objects created during the
+  // update are not updated until the next frame.
+  const RuntimeObjNonOwningPtrList& allObjects =
+      objectsInstances.GetAllObjects();
+  for (std::size_t id = 0, count = allObjects.size(); id < count; ++id) {
+    RuntimeObject* object = allObjects[id];
     double elapsedTimeInSeconds =
         static_cast<double>(object->GetElapsedTime(*this)) / 1000000.0;
     object->SetX(object->GetX() +
@@ -329,14 +455,17 @@ void RuntimeScene::ManageObjectsAfterEvents() {
                  (object->TotalForceY() * elapsedTimeInSeconds));
     object->Update(*this);
     object->UpdateForce(elapsedTimeInSeconds);
-    object->DoBehaviorsPostEvents(*this);
+    if (behaviorsScheduler.GetOrder() == BehaviorsScheduler::ObjectsOrder)
+      object->DoBehaviorsPostEvents(*this);
   }
+
+  // Otherwise, behaviors are run once all the objects are updated.
+  if (behaviorsScheduler.GetOrder() != BehaviorsScheduler::ObjectsOrder)
+    behaviorsScheduler.StepPostEvents(*this, allObjects);
 }
 
 void RuntimeScene::ManageObjectsBeforeEvents() {
-  RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
-  for (std::size_t id = 0; id < allObjects.size(); ++id)
-    allObjects[id]->DoBehaviorsPreEvents(*this);
+  behaviorsScheduler.StepPreEvents(*this, objectsInstances.GetAllObjects());
 }
 
 /**
@@ -414,6 +543,69 @@ bool RuntimeScene::LoadFromScene(const gd::Layout& scene) {
 
 bool RuntimeScene::LoadFromSceneAndCustomInstances(
     const gd::Layout& scene, const gd::InitialInstancesContainer& instances) {
+  if (!Load(scene, instances)) return false;
+
+  FinishLoading(instances);
+  return true;
+}
+
+bool RuntimeScene::PreloadFromScene(const gd::Layout& scene) {
+  return Load(scene, scene.GetInitialInstances());
+}
+
+void RuntimeScene::FinishLoading() { FinishLoading(GetInitialInstances()); }
+
+void RuntimeScene::FinishLoading(
+    const gd::InitialInstancesContainer& instances) {
+  // Create the textures of the images not preloaded yet, before creating the
+  // objects using them.
+  resourcesPreloader.Finish();
+
+  // Create object instances which are originally positioned on scene
+  CreateObjectsFrom(instances);
+  resourcesPreloader.ReleaseTextures();
+
+  // Behaviors shared data
+  behaviorsSharedDatas.LoadFrom(GetAllBehaviorSharedData());
+
+  // Extensions specific initialization. This is done on the main thread, as
+  // extensions can change what they share with the scene being played.
+  extensionsToBeNotifiedOnObjectDeletion.clear();
+  for (std::size_t i = 0; i < game->GetUsedExtensions().size(); ++i) {
+    std::shared_ptr<gd::PlatformExtension> gdExtension =
+        CppPlatform::Get().GetExtension(game->GetUsedExtensions()[i]);
+    std::shared_ptr<ExtensionBase> extension =
+        std::dynamic_pointer_cast<ExtensionBase>(gdExtension);
+    if (extension != std::shared_ptr<ExtensionBase>()) {
+      extension->SceneLoaded(*this);
+      if (extension->ToBeNotifiedOnObjectDeletion())
+        extensionsToBeNotifiedOnObjectDeletion.push_back(extension.get());
+    }
+  }
+  loadingFinished = true;
+
+  if (StopSoundsOnStartup()) {
+    game->GetSoundManager().ClearAllSoundsAndMusics();
+  }
+  if (renderWindow) renderWindow->setTitle(GetWindowDefaultTitle());
+}
+
+std::shared_ptr<const RuntimeBehaviorsNames> RuntimeScene::GetBehaviorsNames(
+    const gd::Object& object) {
+  std::vector<gd::String> names;
+  for (auto& it : object.GetAllBehaviors()) names.push_back(it.first);
+
+  std::lock_guard<std::mutex> lock(objectsBehaviorsNamesMutex);
+  std::shared_ptr<const RuntimeBehaviorsNames>& behaviorsNames =
+      objectsBehaviorsNames[object.GetName()];
+  if (!behaviorsNames || behaviorsNames->names != names)
+    behaviorsNames = std::make_shared<RuntimeBehaviorsNames>(names);
+
+  return behaviorsNames;
+}
+
+bool RuntimeScene::Load(const gd::Layout& scene,
+                        const gd::InitialInstancesContainer& instances) {
   std::cout << "Loading RuntimeScene from a scene.";
   if (!game) {
     std::cout << "..No valid gd::Project associated to the RuntimeScene. "
@@ -427,6 +619,7 @@ bool RuntimeScene::LoadFromSceneAndCustomInstances(
 
   // Clear RuntimeScene datas
   objectsInstances.Clear();
+  objectsPool.Clear();
   timeManager.Reset();
 
   std::cout << ".";
@@ -447,33 +640,20 @@ bool RuntimeScene::LoadFromSceneAndCustomInstances(
     layers.push_back(RuntimeLayer(GetLayer(i), defaultView));
   }
 
-  // Create object instances which are originally positioned on scene
-  std::cout << ".";
-  CreateObjectsFrom(instances);
-
-  // Behaviors shared data
-  std::cout << ".";
-  behaviorsSharedDatas.LoadFrom(scene.GetAllBehaviorSharedData());
-
-  std::cout << ".";
-  // Extensions specific initialization
-  for (std::size_t i = 0; i < game->GetUsedExtensions().size(); ++i) {
-    std::shared_ptr<gd::PlatformExtension> gdExtension =
-        CppPlatform::Get().GetExtension(game->GetUsedExtensions()[i]);
-    std::shared_ptr<ExtensionBase> extension =
-        std::dynamic_pointer_cast<ExtensionBase>(gdExtension);
-    if (extension != std::shared_ptr<ExtensionBase>()) {
-      extension->SceneLoaded(*this);
-      if (extension->ToBeNotifiedOnObjectDeletion())
-        extensionsToBeNotifiedOnObjectDeletion.push_back(extension.get());
-    }
-  }
+  // Resolve the slots of all the objects, so that they are not created
+  // lazily while the scene is running.
+  for (std::size_t i = 0; i < game->GetObjectsCount(); ++i)
+    objectsInstances.GetObjectSlot(game->GetObject(i).GetName());
+  for (std::size_t i = 0; i < GetObjectsCount(); ++i)
+    objectsInstances.GetObjectSlot(GetObject(i).GetName());
 
+  // Start decoding the images of the objects in parallel: the objects are
+  // created by FinishLoading, once the textures are created.
   std::cout << ".";
-  if (StopSoundsOnStartup()) {
-    game->GetSoundManager().ClearAllSoundsAndMusics();
-  }
-  if (renderWindow) renderWindow->setTitle(GetWindowDefaultTitle());
+  resourcesPreloader.PreloadImages(
+      ResourcesPreloader::GetImagesUsedByInstances(*game, scene, instances),
+      game->GetResourcesManager(),
+      *game->GetImageManager());
 
   std::cout << " Done." << std::endl;
 
@@ -9,14 +9,19 @@
 #include <SFML/System.hpp>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include "GDCpp/Runtime/BehaviorsRuntimeSharedDataHolder.h"
+#include "GDCpp/Runtime/BehaviorsScheduler.h"
 #include "GDCpp/Runtime/InputManager.h"
 #include "GDCpp/Runtime/ObjInstancesHolder.h"
 #include "GDCpp/Runtime/Project/Layout.h"  //This include must be placed first
+#include "GDCpp/Runtime/ResourcesPreloader.h"
 #include "GDCpp/Runtime/RuntimeLayer.h"
+#include "GDCpp/Runtime/RuntimeObjectsPool.h"
 #include "GDCpp/Runtime/RuntimeVariablesContainer.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
 #include "GDCpp/Runtime/TimeManager.h"
 namespace sf {
 class RenderWindow;
@@ -38,6 +43,7 @@ class RuntimeGame;
 class BehaviorsRuntimeSharedData;
 class ExtensionBase;
 class CodeExecutionEngine;
+struct RuntimeBehaviorsNames;
 #undef GetObject  // Disable an annoying macro
 
 #if defined(GD_IDE_ONLY)
@@ -84,6 +90,26 @@ class GD_API RuntimeScene : public Scene {
    */
   std::shared_ptr<gd::ImageManager> GetImageManager() const;
 
+  /**
+   * \brief Return the names of the behaviors of an object, shared by all the
+   * objects created from it (or from an object with the same name and
+   * behaviors).
+   */
+  std::shared_ptr<const RuntimeBehaviorsNames> GetBehaviorsNames(
+      const gd::Object& object);
+
+  /**
+   * \brief Get the scheduler running the behaviors of the objects, to change
+   * the order in which they are run.
+   */
+  BehaviorsScheduler& GetBehaviorsScheduler() { return behaviorsScheduler; }
+
+  /**
+   * \brief Get the pool keeping the objects deleted from the scene, to reuse
+   * them when objects are created.
+   */
+  RuntimeObjectsPool& GetObjectsPool() { return objectsPool; }
+
   /**
    * \brief Get the input manager used to handle mouse, keyboard and touches
    * events.
@@ -146,6 +172,32 @@ class GD_API RuntimeScene : public Scene {
   bool LoadFromSceneAndCustomInstances(
       const gd::Layout& scene, const gd::InitialInstancesContainer& instances);
 
+  /**
+   * \brief Set up the RuntimeScene using a gd::Layout, like LoadFromScene, but
+   * without changing what is shared with the scene being played (the sounds of
+   * the game, the window and the data of the extensions), so that it can be
+   * done by another thread.
+   *
+   * The images of the objects are decoded in background: the main thread can
+   * call GetResourcesPreloader().Update() to create their textures as they
+   * are decoded. FinishLoading must then be called by the main thread before
+   * playing the scene.
+   *
+   * \see SceneStack::Preload
+   */
+  bool PreloadFromScene(const gd::Layout& scene);
+
+  /**
+   * \brief Do the part of the loading left by PreloadFromScene: create the
+   * textures of the images not loaded yet and the objects of the scene, notify
+   * the extensions that the scene is loaded, stop the sounds if requested by
+   * the scene and update the title of the window.
+   *
+   * \note A scene destroyed without FinishLoading being called (like a
+   * discarded preload) does not notify the extensions that it is unloaded.
+   */
+  void FinishLoading();
+
   /**
    * Create the objects from an gd::InitialInstancesContainer object.
    *
@@ -185,6 +237,58 @@ class GD_API RuntimeScene : public Scene {
    */
   void RenderWithoutStep();
 
+  /**
+   * \brief Update the lists of the objects to be rendered on each layer,
+   * sorted by Z order.
+   *
+   * The lists are kept from one frame to another: objects that are still on
+   * the same layer keep their position, new objects (or objects moved to
+   * another layer) are added at the end, and each list is then sorted again
+   * (which is cheap, as Z orders rarely change). Objects with the same Z order
+   * are so always rendered in the same order.
+   *
+   * \note Called automatically when the scene is rendered.
+   */
+  void UpdateRenderedObjects();
+
+  /**
+   * \brief Get the objects rendered on the layer at \a layerIndex, as updated
+   * by the last call to UpdateRenderedObjects.
+   */
+  const RuntimeObjNonOwningPtrList& GetRenderedObjects(
+      std::size_t layerIndex) const {
+    return renderedLayersObjects[layerIndex];
+  }
+
+  /**
+   * \brief Get the number of objects drawn during the last frame (an object
+   * displayed by multiple cameras is counted once for each camera).
+   */
+  std::size_t GetDrawnObjectsCount() const { return drawnObjectsCount; }
+
+  /**
+   * \brief Get the number of objects that were not drawn during the last
+   * frame because they were outside of the area rendered by the camera.
+   */
+  std::size_t GetCulledObjectsCount() const { return culledObjectsCount; }
+
+  /**
+   * \brief Get the size, in bytes, of the textures used by the objects living
+   * on the scene (a texture used by several objects is counted once).
+   *
+   * \note Computed each time it is called, so that textures loaded after the
+   * scene are counted.
+   * \see gd::ImageManager::GetLoadedTexturesSize
+   */
+  std::size_t GetTexturesSize() const;
+
+  /**
+   * \brief Get the preloader decoding the images of the scene, which can be
+   * used to know the progress of the loading of the scene.
+   * \see PreloadFromScene
+   */
+  ResourcesPreloader& GetResourcesPreloader() { return resourcesPreloader; }
+
   /** \name Code execution engine
    * Functions members giving access to the code execution engine.
    */
@@ -222,14 +326,39 @@ class GD_API RuntimeScene : public Scene {
   SceneChange GetRequestedChange() { return requestedChange; }
   void RequestChange(SceneChange::Change change, gd::String sceneName = "");
 
+  /**
+   * \brief Request the scene to be loaded in background, so that a later
+   * change to this scene is done without waiting for it to be loaded.
+   * \see SceneStack::Preload
+   */
+  void RequestPreload(const gd::String& sceneName) {
+    requestedPreload = sceneName;
+  }
+  const gd::String& GetRequestedPreload() const { return requestedPreload; }
+
  protected:
   /**
    * \brief Handle the events made on the scene's window
    */
   void ManageRenderTargetEvents();
 
+  /**
+   * \brief Set up the RuntimeScene, except what is done by FinishLoading.
+   */
+  bool Load(const gd::Layout& scene,
+            const gd::InitialInstancesContainer& instances);
+
+  /**
+   * \brief Finish the loading started by Load, creating the objects from \a
+   * instances.
+   */
+  void FinishLoading(const gd::InitialInstancesContainer& instances);
+
   /**
    * \brief Order an object list according to object's Z coordinate.
+   *
+   * Lists that are already (or nearly) sorted, like the lists of the objects
+   * rendered at the previous frame, are sorted in linear time.
    */
   bool OrderObjectsByZOrder(RuntimeObjNonOwningPtrList& objList);
 
@@ -269,11 +398,36 @@ class GD_API RuntimeScene : public Scene {
                                                ///< object is deleted.
   BehaviorsRuntimeSharedDataHolder
       behaviorsSharedDatas;  ///< Contains all behaviors shared datas.
+  std::map<gd::String, std::shared_ptr<const RuntimeBehaviorsNames>>
+      objectsBehaviorsNames;  ///< The names of the behaviors of each object.
+  std::mutex objectsBehaviorsNamesMutex;  ///< Objects can be created by
+                                          ///< behaviors run in parallel.
+  BehaviorsScheduler behaviorsScheduler;
+  RuntimeObjectsPool objectsPool;  ///< The objects deleted from the scene,
+                                   ///< kept to be reused.
   std::vector<RuntimeLayer>
       layers;  ///< The layers used at runtime to display the scene.
   std::shared_ptr<CodeExecutionEngine> codeExecutionEngine;
   SceneChange
       requestedChange;  ///< What should be done at the end of the frame.
+  gd::String requestedPreload;  ///< The scene to be loaded in background, if
+                                ///< any, requested during the frame.
+  std::vector<RuntimeObjNonOwningPtrList>
+      renderedLayersObjects;  ///< The objects of each layer, sorted by Z
+                              ///< order. \see UpdateRenderedObjects
+  std::vector<RuntimeObjNonOwningPtrList>
+      addedLayersObjects;  ///< The objects added to each layer since the
+                           ///< last call to UpdateRenderedObjects.
+  std::size_t renderedFrame;  ///< Incremented at each call to
+                              ///< UpdateRenderedObjects.
+  SpriteBatch spriteBatch;  ///< Used to draw objects with the same texture
+                            ///< with a single draw call.
+  std::size_t drawnObjectsCount;   ///< \see GetDrawnObjectsCount
+  std::size_t culledObjectsCount;  ///< \see GetCulledObjectsCount
+  ResourcesPreloader resourcesPreloader;  ///< Decode the images of the scene
+                                          ///< and keep them loaded.
+  bool loadingFinished;  ///< True once FinishLoading notified the extensions
+                         ///< that the scene is loaded.
   sf::Clock clock;      ///< The clock used to track time.
 
   static RuntimeLayer
@@ -8,6 +8,7 @@
 #include <wx/wx.h>  //Must be placed first, otherwise we get nice errors relative to "cannot convert 'const TCHAR*'..." in wx/msw/winundef.h
 #endif
 #include <SFML/Graphics.hpp>
+#include <mutex>
 #include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
 #include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
 #include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
@@ -19,6 +20,7 @@
 #include "GDCpp/Runtime/Project/Project.h"
 #include "GDCpp/Runtime/RuntimeLayer.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
 #include "GDCpp/Runtime/TinyXml/tinyxml.h"
 #include "RuntimeSpriteObject.h"
 #if defined(GD_IDE_ONLY)
@@ -49,6 +51,8 @@ RuntimeSpriteObject::RuntimeSpriteObject(RuntimeScene& scene,
       animationSpeedScale(1.f),
       ptrToCurrentSprite(NULL),
       needUpdateCurrentSprite(true),
+      needUpdateHitBoxes(true),
+      imagesModified(false),
       opacity(255),
       blendMode(0),
       isFlippedX(false),
@@ -58,8 +62,16 @@ RuntimeSpriteObject::RuntimeSpriteObject(RuntimeScene& scene,
       colorR(255),
       colorV(255),
       colorB(255) {
-  if (!badSpriteDatas) badSpriteDatas = new gd::Sprite();
+  // Objects can be created by behaviors run in parallel.
+  static std::once_flag badSpriteDatasCreated;
+  std::call_once(badSpriteDatasCreated,
+                 []() { badSpriteDatas = new gd::Sprite(); });
 
+  LoadAnimations(scene, spriteObject);
+}
+
+void RuntimeSpriteObject::LoadAnimations(
+    RuntimeScene& scene, const gd::SpriteObject& spriteObject) {
   animations.clear();
   for (std::size_t i = 0; i < spriteObject.GetAllAnimations().size(); ++i)
     animations.push_back(AnimationProxy(spriteObject.GetAllAnimations()[i]));
@@ -80,6 +92,51 @@ RuntimeSpriteObject::RuntimeSpriteObject(RuntimeScene& scene,
 
 RuntimeSpriteObject::~RuntimeSpriteObject(){};
 
+void RuntimeSpriteObject::GetUsedTextures(
+    std::vector<const SFMLTextureWrapper*>& textures) const {
+  for (const AnimationProxy& animation : animations) {
+    const gd::Animation& anim = animation.Get();
+    for (std::size_t k = 0; k < anim.GetDirectionsCount(); k++) {
+      for (std::size_t l = 0; l < anim.GetDirection(k).GetSpritesCount(); l++) {
+        const gd::Sprite& sprite = anim.GetDirection(k).GetSprite(l);
+        if (sprite.GetSFMLTexture())
+          textures.push_back(sprite.GetSFMLTexture().get());
+      }
+    }
+  }
+}
+
+void RuntimeSpriteObject::Reset(RuntimeScene& scene,
+                                const gd::Object& object) {
+  RuntimeObject::Reset(scene, object);
+
+  // The animations (and their loaded images) are kept, unless the object
+  // modified its images: the SFML sprite is updated from the members below.
+  if (imagesModified)
+    LoadAnimations(scene, static_cast<const gd::SpriteObject&>(object));
+  imagesModified = false;
+
+  currentAnimation = 0;
+  currentDirection = 0;
+  currentAngle = 0;
+  currentSprite = 0;
+  animationStopped = false;
+  timeElapsedOnCurrentSprite = 0.f;
+  animationSpeedScale = 1.f;
+  ptrToCurrentSprite = NULL;
+  needUpdateCurrentSprite = true;
+  needUpdateHitBoxes = true;
+  opacity = 255;
+  blendMode = 0;
+  isFlippedX = false;
+  isFlippedY = false;
+  scaleX = 1;
+  scaleY = 1;
+  colorR = 255;
+  colorV = 255;
+  colorB = 255;
+}
+
 bool RuntimeSpriteObject::ExtraInitializationFromInitialInstance(
     const gd::InitialInstance& position) {
   if (position.floatInfos.find("animation") != position.floatInfos.end())
@@ -92,18 +149,30 @@ bool RuntimeSpriteObject::Draw(sf::RenderTarget& renderTarget) {
   // Don't draw anything if hidden
   if (hidden) return true;
 
-  renderTarget.draw(
-      GetCurrentSFMLSprite(),
-      sf::RenderStates(
-          blendMode == 0
-              ? sf::BlendAlpha
-              : (blendMode == 1
-                     ? sf::BlendAdd
-                     : (blendMode == 2 ? sf::BlendMultiply : sf::BlendNone))));
+  renderTarget.draw(GetCurrentSFMLSprite(),
+                    sf::RenderStates(GetSFMLBlendMode()));
+
+  return true;
+}
+
+bool RuntimeSpriteObject::DrawInBatch(sf::RenderTarget& renderTarget,
+                                      SpriteBatch& batch) {
+  // Don't draw anything if hidden
+  if (hidden) return true;
+
+  batch.Add(renderTarget, GetCurrentSFMLSprite(), GetSFMLBlendMode());
 
   return true;
 }
 
+const sf::BlendMode& RuntimeSpriteObject::GetSFMLBlendMode() const {
+  return blendMode == 0
+             ? sf::BlendAlpha
+             : (blendMode == 1
+                    ? sf::BlendAdd
+                    : (blendMode == 2 ? sf::BlendMultiply : sf::BlendNone));
+}
+
 float RuntimeSpriteObject::GetDrawableX() const {
   return X - GetCurrentSprite().GetOrigin().GetX() * fabs(scaleX);
 }
@@ -127,6 +196,7 @@ void RuntimeSpriteObject::SetWidth(float newWidth) {
     scaleX = newWidth / GetCurrentSFMLSprite().getLocalBounds().width;
     if (isFlippedX) scaleX *= -1;
     needUpdateCurrentSprite = true;
+    needUpdateHitBoxes = true;
   }
 }
 
@@ -135,6 +205,7 @@ void RuntimeSpriteObject::SetHeight(float newHeight) {
     scaleY = newHeight / GetCurrentSFMLSprite().getLocalBounds().height;
     if (isFlippedY) scaleY *= -1;
     needUpdateCurrentSprite = true;
+    needUpdateHitBoxes = true;
   }
 }
 
@@ -199,6 +270,7 @@ void RuntimeSpriteObject::SetScaleX(float val) {
 
   scaleX = val * (isFlippedX ? -1.0 : 1.0);
   needUpdateCurrentSprite = true;
+  needUpdateHitBoxes = true;
 }
 
 void RuntimeSpriteObject::SetScaleY(float val) {
@@ -207,6 +279,7 @@ void RuntimeSpriteObject::SetScaleY(float val) {
 
   scaleY = val * (isFlippedY ? -1.0 : 1.0);
   needUpdateCurrentSprite = true;
+  needUpdateHitBoxes = true;
 }
 
 float RuntimeSpriteObject::GetScaleX() const { return fabs(scaleX); }
@@ -225,10 +298,12 @@ void RuntimeSpriteObject::CopyImageOnImageOfCurrentSprite(
       ->MakeSpriteOwnsItsImage();  // We want to modify only the image of the
                                    // object, not all objects which have the
                                    // same image.
+  imagesModified = true;
   std::shared_ptr<SFMLTextureWrapper> dest =
       ptrToCurrentSprite->GetSFMLTexture();
 
-  // Make sure the coordinates are correct.
+  // Make sure the coordinates are correct. The texture owned by the sprite
+  // only contains the part it displays, so the copy is clipped to it.
   if (xPosition < 0 ||
       static_cast<unsigned>(xPosition) >= dest->texture.getSize().x)
     return;
@@ -252,6 +327,7 @@ void RuntimeSpriteObject::MakeColorTransparent(const gd::String& colorStr) {
       ->MakeSpriteOwnsItsImage();  // We want to modify only the image of the
                                    // object, not all objects which have the
                                    // same image.
+  imagesModified = true;
   std::shared_ptr<SFMLTextureWrapper> dest =
       ptrToCurrentSprite->GetSFMLTexture();
 
@@ -295,6 +371,14 @@ void RuntimeSpriteObject::UpdateCurrentSprite() const {
     }
   }
 
+  // The sprite used when no valid sprite can be displayed has no texture and
+  // is shared by all the objects, which can be updated by several threads
+  // (see gd::Behavior::CanStepInParallel): it is never changed.
+  if (ptrToCurrentSprite == badSpriteDatas) {
+    needUpdateCurrentSprite = false;
+    return;
+  }
+
   ptrToCurrentSprite->GetSFMLSprite().setOrigin(
       ptrToCurrentSprite->GetCenter().GetX(),
       ptrToCurrentSprite->GetCenter().GetY());
@@ -339,6 +423,7 @@ void RuntimeSpriteObject::Update(const RuntimeScene& scene) {
 
   float delay = direction.GetTimeBetweenFrames();
 
+  std::size_t previousSprite = currentSprite;
   if (timeElapsedOnCurrentSprite > delay) {
     if (delay != 0) {
       std::size_t frameCount =
@@ -357,6 +442,7 @@ void RuntimeSpriteObject::Update(const RuntimeScene& scene) {
   }
 
   needUpdateCurrentSprite = true;
+  if (currentSprite != previousSprite) needUpdateHitBoxes = true;
 }
 
 const sf::Sprite& RuntimeSpriteObject::GetCurrentSFMLSprite() const {
@@ -371,14 +457,30 @@ const gd::Sprite& RuntimeSpriteObject::GetCurrentSprite() const {
   return *ptrToCurrentSprite;
 }
 
-std::vector<Polygon2d> RuntimeSpriteObject::GetHitBoxes() const {
+const std::vector<Polygon2d>& RuntimeSpriteObject::GetHitBoxes() const {
+  if (needUpdateHitBoxes) UpdateHitBoxes();
+
+  return hitBoxes;
+}
+
+const sf::FloatRect& RuntimeSpriteObject::GetAABB() const {
+  if (needUpdateHitBoxes) UpdateHitBoxes();
+
+  return aabb;
+}
+
+void RuntimeSpriteObject::UpdateHitBoxes() const {
+  RuntimeObject::GetAABB();  // Update aabb.
+  needUpdateHitBoxes = false;
+
   if (currentAnimation >= animations.size()) {
-    std::vector<Polygon2d> hitboxes;  // Invalid animation, bail out.
-    return hitboxes;
+    hitBoxes.clear();  // Invalid animation, no hitboxes.
+    return;
   }
   const sf::Sprite& currentSFMLSprite = GetCurrentSFMLSprite();
 
-  std::vector<Polygon2d> polygons = GetCurrentSprite().GetCollisionMask();
+  std::vector<Polygon2d>& polygons = hitBoxes;
+  polygons = GetCurrentSprite().GetCollisionMask();
   for (std::size_t i = 0; i < polygons.size(); ++i) {
     for (std::size_t j = 0; j < polygons[i].vertices.size(); ++j) {
       sf::Vector2f newVertice = currentSFMLSprite.getTransform().transformPoint(
@@ -393,8 +495,6 @@ std::vector<Polygon2d> RuntimeSpriteObject::GetHitBoxes() const {
       polygons[i].vertices[j] = newVertice;
     }
   }
-
-  return polygons;
 }
 
 bool RuntimeSpriteObject::SetSprite(std::size_t nb) {
@@ -411,6 +511,7 @@ bool RuntimeSpriteObject::SetSprite(std::size_t nb) {
   timeElapsedOnCurrentSprite = 0;
 
   needUpdateCurrentSprite = true;
+  needUpdateHitBoxes = true;
   return true;
 }
 
@@ -423,6 +524,7 @@ bool RuntimeSpriteObject::SetCurrentAnimation(std::size_t nb) {
   timeElapsedOnCurrentSprite = 0;
 
   needUpdateCurrentSprite = true;
+  needUpdateHitBoxes = true;
   return true;
 }
 
@@ -453,6 +555,7 @@ bool RuntimeSpriteObject::SetDirection(float nb) {
     currentAngle = nb;
 
     needUpdateCurrentSprite = true;
+    needUpdateHitBoxes = true;
     return true;
   } else {
     if (nb >= animations[currentAnimation].Get().GetDirectionsCount() ||
@@ -466,6 +569,7 @@ bool RuntimeSpriteObject::SetDirection(float nb) {
     timeElapsedOnCurrentSprite = 0;
 
     needUpdateCurrentSprite = true;
+    needUpdateHitBoxes = true;
     return true;
   }
 }
@@ -477,6 +581,7 @@ bool RuntimeSpriteObject::SetAngle(float newAngle) {
     currentAngle = newAngle;
 
     needUpdateCurrentSprite = true;
+    needUpdateHitBoxes = true;
   } else {
     newAngle = static_cast<int>(newAngle) % 360;
     if (newAngle < 0) newAngle += 360;
@@ -537,6 +642,7 @@ void RuntimeSpriteObject::FlipX(bool flip) {
   if (flip != isFlippedX) {
     scaleX *= -1.0;
     needUpdateCurrentSprite = true;
+    needUpdateHitBoxes = true;
   }
   isFlippedX = flip;
 }
@@ -545,6 +651,7 @@ void RuntimeSpriteObject::FlipY(bool flip) {
   if (flip != isFlippedY) {
     scaleY *= -1.0;
     needUpdateCurrentSprite = true;
+    needUpdateHitBoxes = true;
   }
   isFlippedY = flip;
 }
@@ -559,8 +666,9 @@ bool RuntimeSpriteObject::CursorOnObject(RuntimeScene& scene, bool accurate) {
   auto insideObject = [this, accurate](const sf::Vector2f& pos) {
     if (GetDrawableX() <= pos.x && GetDrawableX() + GetWidth() >= pos.x &&
         GetDrawableY() <= pos.y && GetDrawableY() + GetHeight() >= pos.y) {
-      int localX = static_cast<int>(pos.x - GetDrawableX());
-      int localY = static_cast<int>(pos.y - GetDrawableY());
+      const sf::IntRect& textureRect = GetCurrentSFMLSprite().getTextureRect();
+      int localX = textureRect.left + static_cast<int>(pos.x - GetDrawableX());
+      int localY = textureRect.top + static_cast<int>(pos.y - GetDrawableY());
 
       return (!accurate || GetCurrentSprite()
                                    .GetSFMLTexture()
@@ -20,6 +20,9 @@ class Layout;
 namespace sf {
 class Sprite;
 }
+namespace sf {
+struct BlendMode;
+}
 namespace gd {
 class Sprite;
 }
@@ -74,10 +77,16 @@ class GD_API RuntimeSpriteObject : public RuntimeObject {
     return gd::make_unique<RuntimeSpriteObject>(*this);
   }
 
+  virtual bool CanBeRecycled() const { return true; }
+  virtual void Reset(RuntimeScene& scene, const gd::Object& object);
+
   virtual bool ExtraInitializationFromInitialInstance(
       const gd::InitialInstance& position);
 
   virtual bool Draw(sf::RenderTarget& renderTarget);
+  virtual bool DrawInBatch(sf::RenderTarget& renderTarget, SpriteBatch& batch);
+  virtual void GetUsedTextures(
+      std::vector<const SFMLTextureWrapper*>& textures) const;
 
 #if defined(GD_IDE_ONLY)
   virtual void GetPropertyForDebugger(std::size_t propertyNb,
@@ -89,7 +98,10 @@ class GD_API RuntimeSpriteObject : public RuntimeObject {
 
   virtual void Update(const RuntimeScene& scene);
 
-  virtual void OnPositionChanged() { needUpdateCurrentSprite = true; };
+  virtual void OnPositionChanged() {
+    needUpdateCurrentSprite = true;
+    needUpdateHitBoxes = true;
+  };
 
   virtual float GetWidth() const;
   virtual float GetHeight() const;
@@ -105,7 +117,21 @@ class GD_API RuntimeSpriteObject : public RuntimeObject {
   virtual bool SetAngle(float newAngle);
   virtual float GetAngle() const;
 
-  virtual std::vector<Polygon2d> GetHitBoxes() const;
+  /**
+   * \brief Get the hitboxes of the current sprite, in "world" coordinates.
+   * \note Hitboxes are only computed again when the position, angle, scale,
+   * flipping or frame of the object changed.
+   */
+  virtual const std::vector<Polygon2d>& GetHitBoxes() const;
+
+  /**
+   * \brief Get the object AABB.
+   * \note Like hitboxes, the AABB is only computed again when needed.
+   */
+  virtual const sf::FloatRect& GetAABB() const;
+
+  virtual bool IsDrawnInsideAABB() const { return true; }
+
   virtual bool CursorOnObject(RuntimeScene& scene, bool accurate);
 
   /**
@@ -346,10 +372,31 @@ class GD_API RuntimeSpriteObject : public RuntimeObject {
   float timeElapsedOnCurrentSprite;
   float animationSpeedScale;
 
+  /**
+   * \brief Compute the hitboxes and the AABB of the object.
+   */
+  void UpdateHitBoxes() const;
+
+  /**
+   * \brief Return the SFML blend mode corresponding to the blend mode of the
+   * object.
+   */
+  const sf::BlendMode& GetSFMLBlendMode() const;
+
+  /**
+   * \brief Create the animations of the object, and load their images.
+   */
+  void LoadAnimations(RuntimeScene& scene,
+                      const gd::SpriteObject& spriteObject);
+
   mutable gd::Sprite* ptrToCurrentSprite;  // Pointer to the current sprite
   mutable bool needUpdateCurrentSprite;
+  mutable bool needUpdateHitBoxes;  ///< True if hitBoxes and aabb must be
+                                    ///< computed again.
 
   std::vector<AnimationProxy> animations;
+  bool imagesModified;  ///< True if the images of the sprites were modified
+                        ///< by the object (see MakeColorTransparent).
 
   float opacity;
   unsigned int blendMode;
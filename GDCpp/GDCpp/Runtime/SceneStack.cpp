@@ -4,7 +4,10 @@
  * reserved. This project is released under the MIT License.
  */
 #include "SceneStack.h"
+#include <algorithm>
 #include "CodeExecutionEngine.h"
+#include "FontManager.h"
+#include "ResourcesLoader.h"
 #include "RuntimeGame.h"
 #include "RuntimeScene.h"
 #include "SceneNameMangler.h"
@@ -13,7 +16,23 @@ bool SceneStack::Step() {
   if (stack.empty()) return false;
 
   auto& scene = stack.back();
-  if (scene->RenderAndStep()) {
+  bool changeRequested = scene->RenderAndStep();
+  if (!scene->GetRequestedPreload().empty())
+    Preload(scene->GetRequestedPreload());
+  UpdatePreload();
+
+  // Destroy the discarded preloads that are done.
+  discardedPreloads.erase(
+      std::remove_if(
+          discardedPreloads.begin(),
+          discardedPreloads.end(),
+          [](const std::future<std::unique_ptr<RuntimeScene>>& preload) {
+            return preload.wait_for(std::chrono::seconds(0)) ==
+                   std::future_status::ready;
+          }),
+      discardedPreloads.end());
+
+  if (changeRequested) {
     auto request = scene->GetRequestedChange();
     if (request.change == RuntimeScene::SceneChange::STOP_GAME) {
       return false;
@@ -49,8 +68,20 @@ RuntimeScene* SceneStack::Push(gd::String newSceneName) {
     return nullptr;
   }
 
-  std::unique_ptr<RuntimeScene> newScene(new RuntimeScene(window, &game));
-  if (!newScene->LoadFromScene(game.GetLayout(newSceneName))) {
+  std::unique_ptr<RuntimeScene> newScene;
+  if ((preloadingScene.valid() || preloadedScene) &&
+      preloadedSceneName == newSceneName) {
+    // Wait for the scene if it is still being loaded in background.
+    if (preloadingScene.valid()) preloadedScene = preloadingScene.get();
+    newScene = std::move(preloadedScene);
+    if (newScene) newScene->FinishLoading();
+  } else {
+    newScene.reset(new RuntimeScene(window, &game));
+    if (!newScene->LoadFromScene(game.GetLayout(newSceneName)))
+      newScene.reset();
+  }
+
+  if (!newScene) {
     if (errorCallback)
       errorCallback("Unable to load scene \"" + newSceneName + "\".");
     return nullptr;
@@ -76,3 +107,52 @@ RuntimeScene* SceneStack::Replace(gd::String newSceneName, bool clear) {
   }
   return Push(newSceneName);
 }
+
+void SceneStack::Preload(gd::String sceneName) {
+  if ((preloadingScene.valid() || preloadedScene) &&
+      preloadedSceneName == sceneName)
+    return;
+  if (!game.HasLayoutNamed(sceneName)) {
+    if (errorCallback)
+      errorCallback("Scene \"" + sceneName + "\" does not exist.");
+    return;
+  }
+
+  // Make sure the singletons are created before being used by the thread.
+  gd::ResourcesLoader::Get();
+  FontManager::Get();
+
+  // The scene is created without a window, and FinishLoading is called when
+  // the scene is pushed, so that nothing used by the current scene is changed.
+  // Don't wait for the scene previously preloaded if it is still being loaded.
+  if (preloadingScene.valid() &&
+      preloadingScene.wait_for(std::chrono::seconds(0)) !=
+          std::future_status::ready)
+    discardedPreloads.push_back(std::move(preloadingScene));
+  preloadedScene.reset();
+
+  RuntimeGame* scenesGame = &game;
+  const gd::Layout& layout = game.GetLayout(sceneName);
+  preloadedSceneName = sceneName;
+  preloadingScene = std::async(std::launch::async, [scenesGame, &layout]() {
+    std::unique_ptr<RuntimeScene> scene(new RuntimeScene(nullptr, scenesGame));
+    if (!scene->PreloadFromScene(layout)) scene.reset();
+
+    return scene;
+  });
+}
+
+void SceneStack::UpdatePreload() {
+  if (preloadingScene.valid() &&
+      preloadingScene.wait_for(std::chrono::seconds(0)) ==
+          std::future_status::ready)
+    preloadedScene = preloadingScene.get();
+
+  // Textures must be created by the main thread.
+  if (preloadedScene) preloadedScene->GetResourcesPreloader().Update();
+}
+
+bool SceneStack::IsPreloaded(const gd::String& sceneName) const {
+  return preloadedScene && preloadedSceneName == sceneName &&
+         preloadedScene->GetResourcesPreloader().GetProgress() == 1;
+}
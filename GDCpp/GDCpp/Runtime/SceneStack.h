@@ -5,6 +5,7 @@
  */
 #include <GDCpp/Runtime/String.h>
 #include <functional>
+#include <future>
 #include <memory>
 #include <vector>
 class RuntimeGame;
@@ -32,7 +33,8 @@ class GD_API SceneStack {
    * \brief Execute one step of the game.
    *
    * RuntimeScene::RenderAndStep is called on the current scene. If a scene
-   * change was requested, the stack is updated.
+   * change was requested, the stack is updated. The textures of the images
+   * decoded so far for the preloaded scene, if any, are created.
    *
    * This method is typically called in a loop until it returns false.
    * \return false if game must be stopped.
@@ -64,6 +66,28 @@ class GD_API SceneStack {
    */
   RuntimeScene *Replace(gd::String newSceneName, bool clear = false);
 
+  /**
+   * \brief Start loading a scene in a background thread, while the current
+   * scene keeps being played. A later call to Push or Replace with this scene
+   * uses it, instead of loading the scene again.
+   *
+   * Only the decoding of the images and the setup of the scene are done in
+   * background: the textures are created by Step, and the objects are created
+   * when the scene is pushed.
+   *
+   * \note Only one scene is preloaded at a time: if another scene was
+   * preloaded, it is discarded. If it is still being loaded, the loading
+   * continues in background and the scene is destroyed once it is done,
+   * without waiting for it.
+   */
+  void Preload(gd::String sceneName);
+
+  /**
+   * \brief Return true if the scene was preloaded and is ready to be used,
+   * with the textures of all its images created by Step.
+   */
+  bool IsPreloaded(const gd::String &sceneName) const;
+
   /**
    * \brief Set the callback called when an error occurs (loading failed...)
    */
@@ -77,9 +101,25 @@ class GD_API SceneStack {
   }
 
  private:
+  /**
+   * \brief Take the preloaded scene once it is set up in background, and
+   * create the textures of the images decoded so far.
+   */
+  void UpdatePreload();
+
   RuntimeGame &game;
   sf::RenderWindow *window;
   std::vector<std::unique_ptr<RuntimeScene>> stack;
+  gd::String preloadedSceneName;
+  std::future<std::unique_ptr<RuntimeScene>>
+      preloadingScene;  ///< The scene being set up in background, if any.
+  std::unique_ptr<RuntimeScene>
+      preloadedScene;  ///< The scene set up in background, whose textures are
+                       ///< created by Step until it is pushed.
+  std::vector<std::future<std::unique_ptr<RuntimeScene>>>
+      discardedPreloads;  ///< Preloads replaced by another one while they were
+                          ///< still running, kept until they are done (as
+                          ///< destroying them would wait for them).
   std::function<void(gd::String)> errorCallback;
   std::function<bool(RuntimeScene &)> loadCallback;
 };
@@ -61,9 +61,7 @@ void SoundManager::PlayMusic(const gd::String& name,
 #if !defined(GD_IDE_ONLY)
   gd::ResourcesLoader* ressourcesLoader = gd::ResourcesLoader::Get();
   if (ressourcesLoader->HasFile(file)) {
-    std::size_t size = ressourcesLoader->GetBinaryFileSize(file);
-    music->SetBuffer(ressourcesLoader->LoadBinaryFile(file), size);
-    music->OpenFromMemory(size);
+    music->OpenFromStream(ressourcesLoader->OpenStream(file));
   } else
 #endif
   {
@@ -89,9 +87,7 @@ void SoundManager::PlayMusicOnChannel(const gd::String& name,
 #if !defined(GD_IDE_ONLY)
   gd::ResourcesLoader* ressourcesLoader = gd::ResourcesLoader::Get();
   if (ressourcesLoader->HasFile(file)) {
-    std::size_t size = ressourcesLoader->GetBinaryFileSize(file);
-    music->SetBuffer(ressourcesLoader->LoadBinaryFile(file), size);
-    music->OpenFromMemory(size);
+    music->OpenFromStream(ressourcesLoader->OpenStream(file));
   } else
 #endif
   {
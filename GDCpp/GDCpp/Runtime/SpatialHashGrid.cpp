@@ -0,0 +1,71 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/SpatialHashGrid.h"
+#include <cmath>
+
+namespace {
+const int maxCellsPerBox = 64;
+const float maxCellCoordinate = 1000000000.f;
+}  // namespace
+
+void SpatialHashGrid::Reset(float cellSize_) {
+  cellSize = cellSize_ >= 1 ? cellSize_ : 1;
+
+  // Keep the cells (and the memory of their lists) to reuse them, unless
+  // there are many more cells than boxes, which happens when the boxes are
+  // moving from one use of the grid to the other.
+  if (cells.size() > maxCellsPerBox * (boxes.size() + 1))
+    cells.clear();
+  else
+    for (auto& cell : cells) cell.second.clear();
+  boxes.clear();
+  outOfGrid.clear();
+  stamps.clear();
+  queryStamp = 0;
+}
+
+std::size_t SpatialHashGrid::Insert(const sf::FloatRect& bounds) {
+  std::size_t id = boxes.size();
+  boxes.push_back(bounds);
+  stamps.push_back(0);
+
+  int minCellX, minCellY, maxCellX, maxCellY;
+  if (!GetCells(bounds, minCellX, minCellY, maxCellX, maxCellY)) {
+    outOfGrid.push_back(id);
+    return id;
+  }
+
+  for (int cellX = minCellX; cellX <= maxCellX; ++cellX) {
+    for (int cellY = minCellY; cellY <= maxCellY; ++cellY)
+      cells[GetCellKey(cellX, cellY)].push_back(id);
+  }
+
+  return id;
+}
+
+bool SpatialHashGrid::GetCells(const sf::FloatRect& bounds,
+                               int& minCellX,
+                               int& minCellY,
+                               int& maxCellX,
+                               int& maxCellY) const {
+  float minX = std::floor(bounds.left / cellSize);
+  float minY = std::floor(bounds.top / cellSize);
+  float maxX = std::floor((bounds.left + bounds.width) / cellSize);
+  float maxY = std::floor((bounds.top + bounds.height) / cellSize);
+
+  // Also reject NaN, for which all comparisons are false.
+  if (!(minX >= -maxCellCoordinate && maxX <= maxCellCoordinate &&
+        minY >= -maxCellCoordinate && maxY <= maxCellCoordinate &&
+        minX <= maxX && minY <= maxY))
+    return false;
+  if ((maxX - minX + 1) * (maxY - minY + 1) > maxCellsPerBox) return false;
+
+  minCellX = static_cast<int>(minX);
+  minCellY = static_cast<int>(minY);
+  maxCellX = static_cast<int>(maxX);
+  maxCellY = static_cast<int>(maxY);
+  return true;
+}
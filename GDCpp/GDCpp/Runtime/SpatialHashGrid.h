@@ -0,0 +1,123 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCPP_SPATIALHASHGRID_H
+#define GDCPP_SPATIALHASHGRID_H
+
+#include <SFML/Graphics/Rect.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief A uniform grid, storing bounding boxes in the cells they overlap, to
+ * quickly find the boxes overlapping an area.
+ *
+ * Boxes are identified by the index they were inserted at. Boxes that would
+ * cover too many cells (or that are not finite) are not stored in the grid but
+ * are always returned as candidates.
+ *
+ * \see TwoObjectListsTest
+ * \ingroup GameEngine
+ */
+class GD_API SpatialHashGrid {
+ public:
+  SpatialHashGrid() : cellSize(1), queryStamp(0){};
+
+  /**
+   * \brief Remove all the boxes and set the size of the cells.
+   *
+   * The memory used by the grid is kept, so that a grid reused for boxes
+   * covering the same cells does not allocate memory.
+   *
+   * \note The size of the cells should be close to the size of the boxes
+   * that will be inserted.
+   */
+  void Reset(float cellSize);
+
+  /**
+   * \brief Insert a box in the grid.
+   * \return The index of the box.
+   */
+  std::size_t Insert(const sf::FloatRect& bounds);
+
+  /**
+   * \brief Return the number of boxes in the grid.
+   */
+  std::size_t GetCount() const { return boxes.size(); }
+
+  /**
+   * \brief Call \a function with the index of each box overlapping \a area.
+   *
+   * Each box is given only once, even if it spans multiple cells. Boxes
+   * touching \a area by an edge are considered as overlapping.
+   */
+  template <typename Function>
+  void ForEachOverlapping(const sf::FloatRect& area, Function function) {
+    int minCellX, minCellY, maxCellX, maxCellY;
+    if (!GetCells(area, minCellX, minCellY, maxCellX, maxCellY)) {
+      for (std::size_t id = 0; id < boxes.size(); ++id) function(id);
+      return;
+    }
+
+    ++queryStamp;
+    for (std::size_t id : outOfGrid) {
+      stamps[id] = queryStamp;
+      function(id);
+    }
+
+    for (int cellX = minCellX; cellX <= maxCellX; ++cellX) {
+      for (int cellY = minCellY; cellY <= maxCellY; ++cellY) {
+        auto cell = cells.find(GetCellKey(cellX, cellY));
+        if (cell == cells.end()) continue;
+
+        for (std::size_t id : cell->second) {
+          if (stamps[id] == queryStamp) continue;
+          stamps[id] = queryStamp;
+
+          if (AreOverlapping(boxes[id], area)) function(id);
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Return true if the two boxes are overlapping, or touching by an
+   * edge.
+   */
+  static bool AreOverlapping(const sf::FloatRect& a, const sf::FloatRect& b) {
+    return a.left <= b.left + b.width && b.left <= a.left + a.width &&
+           a.top <= b.top + b.height && b.top <= a.top + a.height;
+  }
+
+ private:
+  /**
+   * \brief Compute the range of cells covered by the box.
+   * \return false if the box is not finite or covers too many cells.
+   */
+  bool GetCells(const sf::FloatRect& bounds,
+                int& minCellX,
+                int& minCellY,
+                int& maxCellX,
+                int& maxCellY) const;
+
+  static std::uint64_t GetCellKey(int cellX, int cellY) {
+    // Shift unsigned values, as shifting negative ones is undefined.
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellX))
+            << 32) |
+           static_cast<std::uint32_t>(cellY);
+  }
+
+  float cellSize;
+  std::unordered_map<std::uint64_t, std::vector<std::size_t> >
+      cells;  ///< The indices of the boxes overlapping each cell.
+  std::vector<sf::FloatRect> boxes;     ///< The inserted boxes.
+  std::vector<std::size_t> outOfGrid;   ///< The boxes not stored in cells.
+  std::vector<std::size_t> stamps;      ///< The last query each box was
+                                        ///< given to, to avoid duplicates.
+  std::size_t queryStamp;
+};
+
+#endif  // GDCPP_SPATIALHASHGRID_H
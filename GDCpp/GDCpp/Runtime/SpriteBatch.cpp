@@ -0,0 +1,68 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/SpriteBatch.h"
+#include <cstdlib>
+
+void SpriteBatch::Add(sf::RenderTarget& renderTarget,
+                      const sf::Sprite& sprite,
+                      const sf::BlendMode& blendMode) {
+  Add(renderTarget,
+      sprite.getTexture(),
+      blendMode,
+      sprite.getTransform(),
+      sprite.getTextureRect(),
+      sprite.getColor());
+}
+
+void SpriteBatch::Add(sf::RenderTarget& renderTarget,
+                      const sf::Texture* texture_,
+                      const sf::BlendMode& blendMode_,
+                      const sf::Transform& transform,
+                      const sf::IntRect& textureRect,
+                      const sf::Color& color) {
+  if (!texture_) return;  // Like sf::Sprite, draw nothing without a texture.
+
+  if (!vertices.empty() && (texture_ != texture || blendMode_ != blendMode))
+    Flush(renderTarget);
+
+  texture = texture_;
+  blendMode = blendMode_;
+
+  // Same positions and texture coordinates as sf::Sprite.
+  float width = std::abs(textureRect.width);
+  float height = std::abs(textureRect.height);
+  float left = textureRect.left;
+  float right = left + textureRect.width;
+  float top = textureRect.top;
+  float bottom = top + textureRect.height;
+
+  sf::Vertex topLeft(
+      transform.transformPoint(0, 0), color, sf::Vector2f(left, top));
+  sf::Vertex topRight(
+      transform.transformPoint(width, 0), color, sf::Vector2f(right, top));
+  sf::Vertex bottomRight(transform.transformPoint(width, height),
+                         color,
+                         sf::Vector2f(right, bottom));
+  sf::Vertex bottomLeft(
+      transform.transformPoint(0, height), color, sf::Vector2f(left, bottom));
+
+  vertices.push_back(topLeft);
+  vertices.push_back(topRight);
+  vertices.push_back(bottomLeft);
+  vertices.push_back(bottomLeft);
+  vertices.push_back(topRight);
+  vertices.push_back(bottomRight);
+}
+
+void SpriteBatch::Flush(sf::RenderTarget& renderTarget) {
+  if (vertices.empty()) return;
+
+  sf::RenderStates states(blendMode);
+  states.texture = texture;
+  renderTarget.draw(&vertices[0], vertices.size(), sf::Triangles, states);
+  drawCallsCount++;
+  vertices.clear();
+}
@@ -0,0 +1,70 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCPP_SPRITEBATCH_H
+#define GDCPP_SPRITEBATCH_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+/**
+ * \brief Collect textured rectangles (typically the sprites of objects) to
+ * draw them with a single draw call, as long as they use the same texture and
+ * blend mode.
+ *
+ * Rectangles are drawn when a rectangle with another texture or blend mode is
+ * added, or when Flush is called. Objects that are drawn directly on the
+ * render target must call Flush before, so that they are drawn above the
+ * rectangles added before them.
+ *
+ * \see RuntimeObject::DrawInBatch
+ * \ingroup GameEngine
+ */
+class GD_API SpriteBatch {
+ public:
+  SpriteBatch() : texture(NULL), drawCallsCount(0){};
+
+  /**
+   * \brief Add a sprite to the batch.
+   */
+  void Add(sf::RenderTarget& renderTarget,
+           const sf::Sprite& sprite,
+           const sf::BlendMode& blendMode);
+
+  /**
+   * \brief Add a rectangle displaying the \a textureRect part of \a texture,
+   * transformed by \a transform, to the batch.
+   */
+  void Add(sf::RenderTarget& renderTarget,
+           const sf::Texture* texture,
+           const sf::BlendMode& blendMode,
+           const sf::Transform& transform,
+           const sf::IntRect& textureRect,
+           const sf::Color& color);
+
+  /**
+   * \brief Draw the rectangles of the batch and empty it.
+   */
+  void Flush(sf::RenderTarget& renderTarget);
+
+  /**
+   * \brief Return the number of vertices waiting to be drawn.
+   */
+  std::size_t GetVertexCount() const { return vertices.size(); }
+
+  /**
+   * \brief Return the number of draw calls made since the batch was created.
+   */
+  std::size_t GetDrawCallsCount() const { return drawCallsCount; }
+
+ private:
+  std::vector<sf::Vertex> vertices;  ///< The vertices of the rectangles, as
+                                     ///< two triangles per rectangle.
+  const sf::Texture* texture;  ///< The texture used by the rectangles.
+  sf::BlendMode blendMode;     ///< The blend mode used by the rectangles.
+  std::size_t drawCallsCount;
+};
+
+#endif  // GDCPP_SPRITEBATCH_H
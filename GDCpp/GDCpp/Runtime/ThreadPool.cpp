@@ -0,0 +1,85 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(std::size_t threadsCount)
+    : stopping(false),
+      generation(0),
+      busyThreads(0),
+      currentFunction(NULL),
+      itemsCount(0),
+      itemsChunkSize(1),
+      nextItem(0) {
+  for (std::size_t i = 1; i < threadsCount; ++i)
+    threads.push_back(std::thread(&ThreadPool::Work, this));
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  workAvailable.notify_all();
+
+  for (std::thread& thread : threads) thread.join();
+}
+
+void ThreadPool::ParallelFor(
+    std::size_t count,
+    std::size_t chunkSize,
+    const std::function<void(std::size_t, std::size_t)>& function) {
+  if (count == 0) return;
+  if (threads.empty() || count <= chunkSize) {
+    function(0, count);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    currentFunction = &function;
+    itemsCount = count;
+    itemsChunkSize = std::max<std::size_t>(chunkSize, 1);
+    nextItem = 0;
+    busyThreads = threads.size();
+    generation++;
+  }
+  workAvailable.notify_all();
+
+  RunChunks();
+
+  std::unique_lock<std::mutex> lock(mutex);
+  workDone.wait(lock, [this]() { return busyThreads == 0; });
+  currentFunction = NULL;
+}
+
+void ThreadPool::Work() {
+  std::size_t doneGeneration = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      workAvailable.wait(lock, [this, doneGeneration]() {
+        return stopping || generation != doneGeneration;
+      });
+      if (stopping) return;
+      doneGeneration = generation;
+    }
+
+    RunChunks();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (--busyThreads == 0) workDone.notify_one();
+  }
+}
+
+void ThreadPool::RunChunks() {
+  while (true) {
+    std::size_t begin = nextItem.fetch_add(itemsChunkSize);
+    if (begin >= itemsCount) return;
+
+    (*currentFunction)(begin, std::min(begin + itemsChunkSize, itemsCount));
+  }
+}
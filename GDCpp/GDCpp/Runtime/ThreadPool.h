@@ -0,0 +1,71 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCPP_THREADPOOL_H
+#define GDCPP_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief A pool of threads used to process ranges of items in parallel.
+ *
+ * The items are split into small chunks, taken one after the other by the
+ * threads of the pool (and the calling thread) as soon as they are done with
+ * the previous one, so that threads finishing early take the remaining work.
+ *
+ * \see BehaviorsScheduler
+ */
+class GD_API ThreadPool {
+ public:
+  /**
+   * \brief Create a pool running the work on \a threadsCount threads,
+   * including the thread calling ParallelFor.
+   */
+  ThreadPool(std::size_t threadsCount);
+  ~ThreadPool();
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * \brief Return the number of threads running the work, including the
+   * thread calling ParallelFor.
+   */
+  std::size_t GetThreadsCount() const { return threads.size() + 1; }
+
+  /**
+   * \brief Call \a function on the chunks of at most \a chunkSize items of the
+   * range [0, \a count), from all the threads. Return once all the items were
+   * processed.
+   *
+   * \warning Must not be called by several threads at once.
+   */
+  void ParallelFor(std::size_t count,
+                   std::size_t chunkSize,
+                   const std::function<void(std::size_t, std::size_t)>& function);
+
+ private:
+  void Work();
+  void RunChunks();
+
+  std::vector<std::thread> threads;
+  std::mutex mutex;
+  std::condition_variable workAvailable;
+  std::condition_variable workDone;
+  bool stopping;           ///< true when the threads must stop.
+  std::size_t generation;  ///< Incremented each time work is available.
+  std::size_t busyThreads;  ///< The threads not done with the current work.
+
+  const std::function<void(std::size_t, std::size_t)>* currentFunction;
+  std::size_t itemsCount;
+  std::size_t itemsChunkSize;
+  std::atomic<std::size_t> nextItem;  ///< The first item of the next chunk.
+};
+
+#endif  // GDCPP_THREADPOOL_H
@@ -0,0 +1,190 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/Tools/LZ4.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace gd {
+
+namespace {
+const std::size_t MinMatch = 4;
+const std::size_t LastLiterals = 5;  ///< The last bytes are always literals.
+const std::size_t MatchSearchLimit = 12;  ///< The last match must start at
+                                          ///< least this number of bytes
+                                          ///< before the end.
+const std::size_t MaxOffset = 65535;
+const int HashBits = 12;
+
+std::uint32_t Read32(const char* data) {
+  std::uint32_t value;
+  memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+std::size_t Hash(std::uint32_t sequence) {
+  return (sequence * 2654435761u) >> (32 - HashBits);
+}
+
+/**
+ * Write a length that did not fit in the 4 bits of the token.
+ */
+void WriteLength(std::size_t length, char* destination, std::size_t& op) {
+  while (length >= 255) {
+    destination[op++] = static_cast<char>(255);
+    length -= 255;
+  }
+  destination[op++] = static_cast<char>(length);
+}
+
+bool ReadLength(const unsigned char* source,
+                std::size_t size,
+                std::size_t& ip,
+                std::size_t& length) {
+  unsigned char byte;
+  do {
+    if (ip >= size) return false;
+    byte = source[ip++];
+    length += byte;
+  } while (byte == 255);
+
+  return true;
+}
+
+/**
+ * Write a sequence: the literals from \a literals, followed by a match
+ * (unless \a matchLength is 0, for the last sequence).
+ */
+bool WriteSequence(const char* literals,
+                   std::size_t literalsLength,
+                   std::size_t offset,
+                   std::size_t matchLength,
+                   char* destination,
+                   std::size_t capacity,
+                   std::size_t& op) {
+  // Token, lengths (1 byte every 255), literals and offset.
+  std::size_t needed = 1 + literalsLength / 255 + 1 + literalsLength + 2 +
+                       matchLength / 255 + 1;
+  if (needed > capacity - op) return false;
+
+  std::size_t token = std::min<std::size_t>(literalsLength, 15) << 4;
+  if (matchLength > 0)
+    token |= std::min<std::size_t>(matchLength - MinMatch, 15);
+  destination[op++] = static_cast<char>(token);
+
+  if (literalsLength >= 15) WriteLength(literalsLength - 15, destination, op);
+  memcpy(destination + op, literals, literalsLength);
+  op += literalsLength;
+
+  if (matchLength > 0) {
+    destination[op++] = static_cast<char>(offset & 0xFF);
+    destination[op++] = static_cast<char>(offset >> 8);
+    if (matchLength - MinMatch >= 15)
+      WriteLength(matchLength - MinMatch - 15, destination, op);
+  }
+
+  return true;
+}
+}  // namespace
+
+std::size_t LZ4::Compress(const char* source,
+                          std::size_t size,
+                          char* destination,
+                          std::size_t capacity) {
+  std::size_t ip = 0, anchor = 0, op = 0;
+
+  if (size >= MatchSearchLimit + 1) {
+    // The last position where each sequence of 4 bytes was seen.
+    std::size_t table[1 << HashBits];
+    std::fill(table, table + (1 << HashBits), size);
+
+    std::size_t limit = size - MatchSearchLimit;
+    while (ip < limit) {
+      std::uint32_t sequence = Read32(source + ip);
+      std::size_t h = Hash(sequence);
+      std::size_t candidate = table[h];
+      table[h] = ip;
+
+      if (candidate >= ip || ip - candidate > MaxOffset ||
+          Read32(source + candidate) != sequence) {
+        ip++;
+        continue;
+      }
+
+      std::size_t matchLength = MinMatch;
+      while (ip + matchLength < size - LastLiterals &&
+             source[candidate + matchLength] == source[ip + matchLength])
+        matchLength++;
+
+      if (!WriteSequence(source + anchor,
+                         ip - anchor,
+                         ip - candidate,
+                         matchLength,
+                         destination,
+                         capacity,
+                         op))
+        return 0;
+
+      ip += matchLength;
+      anchor = ip;
+    }
+  }
+
+  if (!WriteSequence(
+          source + anchor, size - anchor, 0, 0, destination, capacity, op))
+    return 0;
+
+  return op;
+}
+
+bool LZ4::Decompress(const char* source,
+                     std::size_t size,
+                     char* destination,
+                     std::size_t decompressedSize) {
+  const unsigned char* input = reinterpret_cast<const unsigned char*>(source);
+  std::size_t ip = 0, op = 0;
+
+  while (ip < size) {
+    unsigned char token = input[ip++];
+
+    std::size_t literalsLength = token >> 4;
+    if (literalsLength == 15 && !ReadLength(input, size, ip, literalsLength))
+      return false;
+    if (literalsLength > size - ip || literalsLength > decompressedSize - op)
+      return false;
+
+    memcpy(destination + op, source + ip, literalsLength);
+    ip += literalsLength;
+    op += literalsLength;
+
+    // The last sequence has only literals.
+    if (ip == size) break;
+
+    if (size - ip < 2) return false;
+    std::size_t offset = input[ip] | (input[ip + 1] << 8);
+    ip += 2;
+    if (offset == 0 || offset > op) return false;
+
+    std::size_t matchLength = token & 15;
+    if (matchLength == 15 && !ReadLength(input, size, ip, matchLength))
+      return false;
+    matchLength += MinMatch;
+    if (matchLength > decompressedSize - op) return false;
+
+    // The match can overlap the bytes being written.
+    if (offset >= matchLength) {
+      memcpy(destination + op, destination + op - offset, matchLength);
+      op += matchLength;
+    } else {
+      for (std::size_t i = 0; i < matchLength; ++i, ++op)
+        destination[op] = destination[op - offset];
+    }
+  }
+
+  return op == decompressedSize;
+}
+
+}  // namespace gd
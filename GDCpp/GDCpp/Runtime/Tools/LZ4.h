@@ -0,0 +1,60 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCPP_LZ4_H
+#define GDCPP_LZ4_H
+
+#include <cstddef>
+
+namespace gd {
+
+/**
+ * \brief Compress and decompress blocks of data using the LZ4 block format.
+ *
+ * The compression is made for speed rather than ratio: the decompression is
+ * fast enough to be used when loading resources.
+ *
+ * \see DatFile
+ * \ingroup ResourcesManagement
+ */
+class GD_API LZ4 {
+ public:
+  /**
+   * \brief Return the size of the buffer needed to compress \a size bytes,
+   * in the worst case.
+   */
+  static std::size_t GetMaxCompressedSize(std::size_t size) {
+    return size + size / 255 + 16;
+  }
+
+  /**
+   * \brief Compress \a size bytes of \a source into \a destination.
+   *
+   * \param capacity The size of \a destination, which should be at least
+   * GetMaxCompressedSize(size).
+   * \return The size of the compressed data, or 0 if \a destination is too
+   * small.
+   */
+  static std::size_t Compress(const char* source,
+                              std::size_t size,
+                              char* destination,
+                              std::size_t capacity);
+
+  /**
+   * \brief Decompress \a size bytes of \a source into \a destination.
+   *
+   * \param decompressedSize The size of \a destination, which must be the
+   * exact size of the decompressed data.
+   * \return false if the data is invalid.
+   */
+  static bool Decompress(const char* source,
+                         std::size_t size,
+                         char* destination,
+                         std::size_t decompressedSize);
+};
+
+}  // namespace gd
+
+#endif  // GDCPP_LZ4_H
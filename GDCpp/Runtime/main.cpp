@@ -4,6 +4,7 @@
  * This project is released under the MIT License.
  */
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <iostream>
@@ -110,7 +111,12 @@ int main( int argc, char *p_argv[] )
         int size = (fsize+15)&(~15);
 
         cout << "Getting src raw data..." << endl;
-        char * ibuffer = resLoader->LoadBinaryFile( "src" );
+        //The data of the resource file is not copied, so copy it in a buffer padded
+        //to the size of the blocks to be decrypted.
+        std::vector<char> ibuffer(size, 0);
+        const char * src = resLoader->LoadBinaryFile( "src" );
+        if ( src ) std::copy(src, src+fsize, ibuffer.begin());
+        resLoader->ReleaseBinaryFile( "src", src );
         char * obuffer = new char[size];
 
         unsigned char key[] = "-P:j$4t&OHIUVM/Z+u4DeDP.";
@@ -118,7 +124,7 @@ int main( int argc, char *p_argv[] )
 
         aes_ks_t keySetting;
         aes_setks_decrypt(key, 192, &keySetting);
-        aes_cbc_decrypt(reinterpret_cast<const unsigned char*>(ibuffer), reinterpret_cast<unsigned char*>(obuffer),
+        aes_cbc_decrypt(reinterpret_cast<const unsigned char*>(ibuffer.data()), reinterpret_cast<unsigned char*>(obuffer),
             (uint8_t*)iv, size/AES_BLOCK_SIZE, &keySetting);
 
         std::string uncryptedSrc = std::string(obuffer, size);
@@ -0,0 +1,171 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the BehaviorsScheduler of GDevelop C++ Platform.
+ */
+#include "GDCpp/Runtime/BehaviorsScheduler.h"
+#include <memory>
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/Project/Behavior.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+namespace {
+std::vector<gd::String> steps;
+
+class FirstBehavior : public gd::Behavior {
+ public:
+  virtual gd::Behavior* Clone() const { return new FirstBehavior(*this); }
+
+ protected:
+  virtual void DoStepPreEvents(RuntimeScene& scene) {
+    steps.push_back(object->GetName() + ":First");
+  }
+  virtual void DoStepPostEvents(RuntimeScene& scene) {
+    steps.push_back(object->GetName() + ":FirstPost");
+  }
+};
+
+class SecondBehavior : public gd::Behavior {
+ public:
+  virtual gd::Behavior* Clone() const { return new SecondBehavior(*this); }
+
+ protected:
+  virtual void DoStepPreEvents(RuntimeScene& scene) {
+    steps.push_back(object->GetName() + ":Second");
+  }
+};
+
+/**
+ * A behavior creating a copy of its object at its first step (the copy being
+ * considered as already stepped once), and deleting its object at its second
+ * step.
+ */
+class ParallelBehavior : public gd::Behavior {
+ public:
+  ParallelBehavior() : stepsCount(0){};
+  virtual gd::Behavior* Clone() const { return new ParallelBehavior(*this); }
+  virtual bool CanStepInParallel() const { return true; }
+
+  int stepsCount;
+
+ protected:
+  virtual void DoStepPreEvents(RuntimeScene& scene) {
+    stepsCount++;
+    if (stepsCount == 1)
+      scene.objectsInstances.AddObject(
+          std::unique_ptr<RuntimeObject>(new RuntimeObject(*object)));
+    else if (stepsCount == 2)
+      object->DeleteFromScene(scene);
+  }
+};
+
+void AddBehavior(gd::Object& object,
+                 gd::Behavior* behavior,
+                 const gd::String& name) {
+  behavior->SetName(name);
+  object.AddBehavior(behavior);
+}
+}  // namespace
+
+TEST_CASE("BehaviorsScheduler", "[game-engine]") {
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+
+  gd::Object a("A");
+  AddBehavior(a, new FirstBehavior, "1");
+  AddBehavior(a, new SecondBehavior, "2");
+  gd::Object b("B");
+  AddBehavior(b, new SecondBehavior, "1");
+  AddBehavior(b, new FirstBehavior, "2");
+
+  std::vector<std::unique_ptr<RuntimeObject>> ownedObjects;
+  ownedObjects.emplace_back(new RuntimeObject(scene, a));
+  ownedObjects.emplace_back(new RuntimeObject(scene, b));
+  ownedObjects.emplace_back(new RuntimeObject(scene, a));
+  std::vector<RuntimeObject*> objects;
+  for (auto& object : ownedObjects) objects.push_back(object.get());
+
+  SECTION("ObjectsOrder") {
+    BehaviorsScheduler scheduler;
+    REQUIRE(scheduler.GetOrder() == BehaviorsScheduler::ObjectsOrder);
+
+    steps.clear();
+    scheduler.StepPreEvents(scene, objects);
+    REQUIRE(steps == std::vector<gd::String>({"A:First",
+                                              "A:Second",
+                                              "B:Second",
+                                              "B:First",
+                                              "A:First",
+                                              "A:Second"}));
+  }
+
+  SECTION("BehaviorsTypesOrder") {
+    BehaviorsScheduler scheduler;
+    scheduler.SetOrder(BehaviorsScheduler::BehaviorsTypesOrder);
+
+    steps.clear();
+    scheduler.StepPreEvents(scene, objects);
+    REQUIRE(steps == std::vector<gd::String>({"A:First",
+                                              "B:First",
+                                              "A:First",
+                                              "A:Second",
+                                              "B:Second",
+                                              "A:Second"}));
+    REQUIRE(scheduler.GetBehaviorsTypesCount() == 2);
+
+    // Deactivated behaviors are not run.
+    objects[1]->ActivateBehavior("2", false);
+    steps.clear();
+    scheduler.StepPostEvents(scene, objects);
+    REQUIRE(steps == std::vector<gd::String>({"A:FirstPost", "A:FirstPost"}));
+
+    // Objects removed from the list are not run anymore.
+    objects.pop_back();
+    steps.clear();
+    scheduler.StepPreEvents(scene, objects);
+    REQUIRE(steps == std::vector<gd::String>({"A:First", "A:Second", "B:Second"}));
+  }
+
+  SECTION("Behaviors run in parallel") {
+    gd::Object parallelObject("Parallel");
+    AddBehavior(parallelObject, new ParallelBehavior, "Behavior");
+    for (int i = 0; i < 1000; ++i)
+      scene.objectsInstances.AddObject(
+          std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, parallelObject)));
+
+    BehaviorsScheduler scheduler;
+    scheduler.SetOrder(BehaviorsScheduler::BehaviorsTypesOrder);
+    scheduler.SetThreadsCount(4);
+    REQUIRE(scheduler.GetThreadsCount() == 4);
+
+    // Objects created by behaviors are added once all the behaviors were run.
+    scheduler.StepPreEvents(scene, scene.objectsInstances.GetAllObjects());
+    REQUIRE(scene.objectsInstances.GetAllObjects().size() == 2000);
+
+    bool allStepped = true;
+    for (RuntimeObject* object : scene.objectsInstances.GetAllObjects())
+      if (static_cast<ParallelBehavior*>(object->GetBehaviorRawPointer(
+              "Behavior"))->stepsCount != 1)
+        allStepped = false;
+    REQUIRE(allStepped == true);
+
+    // Objects deleted by behaviors are moved to the deleted objects slot once
+    // all the behaviors were run.
+    scheduler.StepPreEvents(scene, scene.objectsInstances.GetAllObjects());
+    REQUIRE(scene.objectsInstances.GetObjectsRawPointers("Parallel").size() ==
+            0);
+    REQUIRE(scene.objectsInstances
+                .GetObjectsRawPointers(
+                    scene.objectsInstances.GetDeletedObjectsSlot())
+                .size() == 2000);
+
+    scheduler.SetThreadsCount(1);
+    REQUIRE(scheduler.GetThreadsCount() == 1);
+  }
+}
@@ -9,7 +9,9 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
 #include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
 #include "catch.hpp"
 
@@ -41,6 +43,52 @@ TEST_CASE("RuntimeScene", "[common]") {
     REQUIRE(scene.GetVariables().Get("MaVar").GetString() == "Hello");
     REQUIRE(scene.GetVariables().Get("MaVar2").GetValue() == 42);
   }
+  SECTION("Rendered objects sorted by Z order") {
+    gd::Layout layout;
+    gd::Object object("MyObject");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+    scene.LoadFromScene(layout);
+
+    std::vector<RuntimeObject*> objects;
+    for (int i = 0; i < 6; ++i) {
+      objects.push_back(scene.objectsInstances.AddObject(
+          std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, object))));
+      objects.back()->SetZOrder(i % 3);
+    }
+    objects[5]->SetLayer("Unknown layer");
+
+    scene.UpdateRenderedObjects();
+    REQUIRE(scene.GetRenderedObjects(0) ==
+            std::vector<RuntimeObject*>({objects[0],
+                                         objects[3],
+                                         objects[1],
+                                         objects[4],
+                                         objects[2]}));
+
+    // Changing the Z order, the layer, deleting and creating objects.
+    objects[2]->SetZOrder(-1);
+    objects[0]->SetLayer("Unknown layer");
+    objects[5]->SetLayer("");
+    scene.objectsInstances.RemoveObject(objects[1]);
+    RuntimeObject* newObject = scene.objectsInstances.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, object)));
+    newObject->SetZOrder(1);
+
+    scene.UpdateRenderedObjects();
+    REQUIRE(scene.GetRenderedObjects(0) ==
+            std::vector<RuntimeObject*>(
+                {objects[2], objects[3], objects[4], newObject, objects[5]}));
+
+    // Objects with the same Z order are kept in the same order, even if the
+    // list of all objects is reordered by deletions.
+    scene.objectsInstances.RemoveObject(objects[3]);
+    scene.UpdateRenderedObjects();
+    REQUIRE(scene.GetRenderedObjects(0) ==
+            std::vector<RuntimeObject*>(
+                {objects[2], objects[4], newObject, objects[5]}));
+  }
 }
 
 TEST_CASE("gd::Project", "[common]") {
@@ -0,0 +1,254 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering DatFile class of GDevelop C++ Platform.
+ */
+#include "GDCpp/Runtime/DatFile.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include "GDCpp/Runtime/Tools/LZ4.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * Create data looking like the content of a game: text with repeated words
+ * if \a compressible is true, random bytes (like compressed images or sounds)
+ * otherwise.
+ */
+std::string CreateContent(std::size_t size, bool compressible, int seed) {
+  std::mt19937 generator(seed);
+  std::string content;
+  if (compressible) {
+    const char* words[] = {"object", "layer", "\"x\": ", "\"y\": ",
+                           "variable", "{\n", "},\n", "behavior"};
+    std::uniform_int_distribution<int> word(0, 7);
+    std::uniform_int_distribution<int> number(0, 999);
+    while (content.size() < size) {
+      content += words[word(generator)];
+      content += std::to_string(number(generator));
+    }
+    content.resize(size);
+  } else {
+    std::uniform_int_distribution<int> byte(0, 255);
+    for (std::size_t i = 0; i < size; ++i)
+      content += static_cast<char>(byte(generator));
+  }
+
+  return content;
+}
+
+void WriteFile(const std::string& filename, const std::string& content) {
+  std::ofstream file(filename, std::ios_base::binary);
+  file.write(content.data(), content.size());
+}
+
+std::string CompressAndDecompress(const std::string& content) {
+  std::vector<char> compressed(gd::LZ4::GetMaxCompressedSize(content.size()));
+  std::size_t compressedSize = gd::LZ4::Compress(
+      content.data(), content.size(), compressed.data(), compressed.size());
+  if (compressedSize == 0) return "Compression failed";
+
+  std::string decompressed(content.size(), '\0');
+  if (!gd::LZ4::Decompress(compressed.data(),
+                           compressedSize,
+                           &decompressed[0],
+                           decompressed.size()))
+    return "Decompression failed";
+
+  return decompressed;
+}
+}  // namespace
+
+TEST_CASE("DatFile", "[game-engine][resources]") {
+  // Create the files to be put in the DAT file.
+  std::string compressible = CreateContent(200000, true, 1);
+  std::string random = CreateContent(70000, false, 2);
+  WriteFile("DatFileTest1.test", "Hello world");
+  WriteFile("DatFileTest2.test", std::string("\0\1\2\3\0", 5));
+  WriteFile("DatFileTest3.test", "");
+  WriteFile("DatFileTest4.test", compressible);
+  WriteFile("DatFileTest5.test", random);
+
+  std::vector<gd::String> files = {"DatFileTest1.test",
+                                   "DatFileTest2.test",
+                                   "DatFileTest3.test",
+                                   "DatFileTest4.test",
+                                   "DatFileTest5.test"};
+  {
+    DatFile datFile;
+    REQUIRE(datFile.Create(files, ".", "DatFileTest.egd") == true);
+    REQUIRE(datFile.Create(files, ".", "DatFileTestCompressed.egd", true) ==
+            true);
+  }
+
+  SECTION("Read files") {
+    DatFile datFile;
+    REQUIRE(datFile.Read("DatFileTest.egd") == true);
+
+    REQUIRE(datFile.ContainsFile("DatFileTest1.test") == true);
+    REQUIRE(datFile.ContainsFile("DatFileTest6.test") == false);
+
+    REQUIRE(datFile.GetFileSize("DatFileTest1.test") == 11);
+    REQUIRE(std::string(datFile.GetFile("DatFileTest1.test"), 11) ==
+            "Hello world");
+    REQUIRE(datFile.GetFileSize("DatFileTest2.test") == 5);
+    REQUIRE(std::string(datFile.GetFile("DatFileTest2.test"), 5) ==
+            std::string("\0\1\2\3\0", 5));
+    REQUIRE(datFile.ContainsFile("DatFileTest3.test") == true);
+    REQUIRE(datFile.GetFileSize("DatFileTest3.test") == 0);
+    REQUIRE(std::string(datFile.GetFile("DatFileTest4.test"),
+                        compressible.size()) == compressible);
+
+    REQUIRE(datFile.GetFile("DatFileTest6.test") == NULL);
+    REQUIRE(datFile.GetFileSize("DatFileTest6.test") == 0);
+
+    // Files are not copied when accessed.
+    REQUIRE(datFile.IsCompressed("DatFileTest4.test") == false);
+    REQUIRE(datFile.GetFile("DatFileTest1.test") ==
+            datFile.GetFile("DatFileTest1.test"));
+  }
+
+  SECTION("Read another file") {
+    DatFile datFile;
+    REQUIRE(datFile.Read("DatFileTest.egd") == true);
+    REQUIRE(datFile.Read("DatFileTest1.test") == false);
+    REQUIRE(datFile.ContainsFile("DatFileTest1.test") == false);
+    REQUIRE(datFile.Read("DatFileTest6.test") == false);
+
+    REQUIRE(datFile.Read("DatFileTest.egd") == true);
+    REQUIRE(datFile.ContainsFile("DatFileTest1.test") == true);
+  }
+
+  SECTION("Read compressed files") {
+    DatFile datFile;
+    REQUIRE(datFile.Read("DatFileTestCompressed.egd") == true);
+
+    // Only the files that can be compressed are compressed.
+    REQUIRE(datFile.IsCompressed("DatFileTest4.test") == true);
+    REQUIRE(datFile.IsCompressed("DatFileTest5.test") == false);
+    REQUIRE(datFile.IsCompressed("DatFileTest3.test") == false);
+
+    REQUIRE(datFile.GetFileSize("DatFileTest1.test") == 11);
+    REQUIRE(std::string(datFile.GetFile("DatFileTest1.test"), 11) ==
+            "Hello world");
+    REQUIRE(datFile.GetFileSize("DatFileTest3.test") == 0);
+    REQUIRE(datFile.GetFileSize("DatFileTest4.test") == compressible.size());
+    REQUIRE(std::string(datFile.GetFile("DatFileTest4.test"),
+                        compressible.size()) == compressible);
+    REQUIRE(std::string(datFile.GetFile("DatFileTest5.test"), random.size()) ==
+            random);
+
+    datFile.ReleaseFile("DatFileTest4.test");
+    REQUIRE(std::string(datFile.GetFile("DatFileTest4.test"),
+                        compressible.size()) == compressible);
+
+    // The content stays valid until all the uses of the file are released.
+    const char* content = datFile.GetFile("DatFileTest4.test");
+    REQUIRE(datFile.GetFile("DatFileTest4.test") == content);
+    datFile.ReleaseFile("DatFileTest4.test");
+    datFile.ReleaseFile("DatFileTest4.test");
+    REQUIRE(std::string(content, compressible.size()) == compressible);
+    datFile.ReleaseFile("DatFileTest4.test");
+
+    std::ifstream compressedFile("DatFileTestCompressed.egd",
+                                 std::ios_base::binary | std::ios_base::ate);
+    std::ifstream rawFile("DatFileTest.egd",
+                          std::ios_base::binary | std::ios_base::ate);
+    REQUIRE((compressedFile.tellg() + std::streamoff(compressible.size() / 2)) <
+            rawFile.tellg());
+  }
+
+  SECTION("DatFileStream") {
+    for (const char* datFileName :
+         {"DatFileTest.egd", "DatFileTestCompressed.egd"}) {
+      DatFile datFile;
+      REQUIRE(datFile.Read(datFileName) == true);
+
+      DatFileStream stream;
+      REQUIRE(stream.open(datFile, "DatFileTest6.test") == false);
+      REQUIRE(stream.open(datFile, "DatFileTest4.test") == true);
+      REQUIRE(stream.getSize() == compressible.size());
+
+      // Read the file by chunks spanning over multiple blocks.
+      std::string content;
+      char chunk[10000];
+      sf::Int64 readCount;
+      while ((readCount = stream.read(chunk, sizeof(chunk))) > 0)
+        content.append(chunk, readCount);
+      REQUIRE(content == compressible);
+      REQUIRE(stream.tell() == compressible.size());
+
+      REQUIRE(stream.seek(DatFile::BlockSize - 5) == DatFile::BlockSize - 5);
+      REQUIRE(stream.read(chunk, 10) == 10);
+      REQUIRE(std::string(chunk, 10) ==
+              compressible.substr(DatFile::BlockSize - 5, 10));
+      REQUIRE(stream.seek(10) == 10);
+      REQUIRE(stream.read(chunk, 10) == 10);
+      REQUIRE(std::string(chunk, 10) == compressible.substr(10, 10));
+    }
+  }
+
+  SECTION("LZ4") {
+    REQUIRE(CompressAndDecompress("") == "");
+    REQUIRE(CompressAndDecompress("a") == "a");
+    REQUIRE(CompressAndDecompress("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa") ==
+            "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+    REQUIRE(CompressAndDecompress(compressible) == compressible);
+    REQUIRE(CompressAndDecompress(random) == random);
+    REQUIRE(CompressAndDecompress(std::string(100000, 'x')) ==
+            std::string(100000, 'x'));
+
+    // Invalid data is detected.
+    char destination[16];
+    REQUIRE(gd::LZ4::Decompress("\xF0", 1, destination, 16) == false);
+    REQUIRE(gd::LZ4::Decompress("\x10" "a\x05\x00", 4, destination, 16) ==
+            false);
+  }
+}
+
+TEST_CASE("DatFile benchmark", "[.][benchmark]") {
+  // Create some files: half of them are compressible (like scenes or
+  // scripts), the others are not (like images or sounds).
+  std::vector<gd::String> files;
+  std::vector<std::string> contents;
+  for (int i = 0; i < 32; ++i) {
+    gd::String filename = "DatFileBenchmark" + gd::String::From(i) + ".test";
+    contents.push_back(CreateContent(1024 * 1024, i % 2 == 0, i));
+    WriteFile(filename.ToLocale(), contents.back());
+    files.push_back(filename);
+  }
+
+  auto measure = [&](const char* name, const gd::String& datFileName,
+                     bool compress) {
+    DatFile().Create(files, ".", datFileName, compress);
+    std::ifstream file(datFileName.ToLocale(),
+                       std::ios_base::binary | std::ios_base::ate);
+
+    auto start = std::chrono::steady_clock::now();
+    std::size_t checksum = 0;
+    {
+      DatFile datFile;
+      datFile.Read(datFileName);
+      for (const gd::String& filename : files) {
+        const char* content = datFile.GetFile(filename);
+        for (long i = 0; i < datFile.GetFileSize(filename); i += 4096)
+          checksum += content[i];
+        datFile.ReleaseFile(filename);
+      }
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << name << ": " << file.tellg() / 1024 << "KB, loaded in "
+              << duration.count() << "us" << std::endl;
+    return checksum;
+  };
+
+  REQUIRE(measure("Raw", "DatFileBenchmark.egd", false) ==
+          measure("Compressed", "DatFileBenchmarkCompressed.egd", true));
+}
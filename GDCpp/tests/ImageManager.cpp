@@ -0,0 +1,74 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the loading and unloading of textures by the
+ * ImageManager of GDevelop C++ Platform.
+ */
+#include "GDCore/Project/ImageManager.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "catch.hpp"
+
+namespace {
+std::shared_ptr<SFMLTextureWrapper> CreateTexture() {
+  auto texture = std::make_shared<SFMLTextureWrapper>();
+  texture->texture.create(16, 16);  // 1KB
+  return texture;
+}
+}  // namespace
+
+TEST_CASE("ImageManager", "[game-engine][resources]") {
+  gd::ResourcesManager resourcesManager;
+  gd::ImageManager imageManager;
+  imageManager.SetResourcesManager(&resourcesManager);
+
+  SECTION("Textures are unloaded when not used anymore") {
+    {
+      auto texture = CreateTexture();
+      imageManager.SetSFMLTexture("Image1", texture);
+      REQUIRE(imageManager.HasLoadedSFMLTexture("Image1") == true);
+      REQUIRE(imageManager.GetLoadedTexturesSize() == 1024);
+    }
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image1") == false);
+    REQUIRE(imageManager.GetLoadedTexturesSize() == 0);
+  }
+
+  SECTION("Textures budget") {
+    imageManager.SetTexturesBudget(3 * 1024);
+    REQUIRE(imageManager.GetTexturesBudget() == 3 * 1024);
+
+    auto usedTexture = CreateTexture();
+    imageManager.SetSFMLTexture("Used", usedTexture);
+    for (int i = 1; i <= 3; ++i) {
+      auto texture = CreateTexture();
+      imageManager.SetSFMLTexture("Image" + gd::String::From(i), texture);
+    }
+
+    // The least recently used texture not used anymore was unloaded.
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Used") == true);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image1") == false);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image2") == true);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image3") == true);
+    REQUIRE(imageManager.GetLoadedTexturesSize() == 3 * 1024);
+
+    // Getting a texture makes it the most recently used.
+    imageManager.GetSFMLTexture("Image2");
+    auto texture = CreateTexture();
+    imageManager.SetSFMLTexture("Image4", texture);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image2") == true);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image3") == false);
+
+    // Textures still used are never unloaded.
+    imageManager.SetTexturesBudget(1024);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Used") == true);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image4") == true);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image2") == false);
+
+    texture.reset();
+    imageManager.SetTexturesBudget(0);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image4") == false);
+    REQUIRE(imageManager.GetLoadedTexturesSize() == 1024);
+  }
+}
@@ -62,4 +62,138 @@ TEST_CASE("ObjInstancesHolder", "[common]") {
     REQUIRE(container.GetObjects("2").size() == 3);
     REQUIRE(container.GetObjectsRawPointers("2").size() == 3);
   }
+  SECTION("Slots") {
+    gd::Object obj1("1");
+    gd::Object obj2("2");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+
+    ObjInstancesHolder container;
+    std::size_t slot2 = container.GetObjectSlot("2");
+    REQUIRE(container.GetObjectSlot("2") == slot2);
+    REQUIRE(container.GetObjectsRawPointers(slot2).size() == 0);
+
+    const RuntimeObjNonOwningPtrList& list2 =
+        container.GetObjectsRawPointers(slot2);
+    container.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1)));
+    container.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj2)));
+    container.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj2)));
+
+    // References to the lists stay valid when new slots are created.
+    REQUIRE(container.GetObjectSlot("1") != slot2);
+    REQUIRE(list2.size() == 2);
+    REQUIRE(container.GetObjects(slot2).size() == 2);
+    REQUIRE(container.GetObjectsRawPointers(container.GetObjectSlot("1"))
+                .size() == 1);
+
+    // Slots are preserved by copies, but identified differently.
+    ObjInstancesHolder copy = container;
+    REQUIRE(copy.GetObjectSlot("2") == slot2);
+    REQUIRE(copy.GetObjectsRawPointers(slot2).size() == 2);
+    REQUIRE(copy.GetSlotsId() != container.GetSlotsId());
+
+    std::size_t slotsId = container.GetSlotsId();
+    container.Clear();
+    REQUIRE(container.GetSlotsId() != slotsId);
+    REQUIRE(container.GetObjectSlotsCount() == 1);  // Deleted objects slot.
+  }
+  SECTION("Removal") {
+    gd::Object obj1("1");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+
+    ObjInstancesHolder container;
+    RuntimeObject* objA = container.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1)));
+    RuntimeObject* objB = container.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1)));
+    RuntimeObject* objC = container.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1)));
+
+    // The last object takes the place of the removed one.
+    container.RemoveObject(objA);
+    REQUIRE(container.GetObjectsRawPointers("1").size() == 2);
+    REQUIRE(container.GetObjectsRawPointers("1")[0] == objC);
+    REQUIRE(container.GetObjectsRawPointers("1")[1] == objB);
+    REQUIRE(container.GetAllObjects().size() == 2);
+
+    // Removing an object not in the container does nothing.
+    RuntimeObject notAdded(scene, obj1);
+    container.RemoveObject(&notAdded);
+    REQUIRE(container.GetObjectsRawPointers("1").size() == 2);
+
+    // Deleted objects are moved to the deleted objects slot, then flushed.
+    ObjInstancesHolder& sceneObjects = scene.objectsInstances;
+    RuntimeObject* objD = sceneObjects.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1)));
+    objD->DeleteFromScene(scene);
+    REQUIRE(sceneObjects.GetObjectsRawPointers("1").size() == 0);
+    REQUIRE(sceneObjects
+                .GetObjectsRawPointers(sceneObjects.GetDeletedObjectsSlot())
+                .size() == 1);
+    REQUIRE(sceneObjects.GetAllObjects().size() == 1);
+
+    sceneObjects.FlushDeletedObjects();
+    REQUIRE(sceneObjects
+                .GetObjectsRawPointers(sceneObjects.GetDeletedObjectsSlot())
+                .size() == 0);
+    REQUIRE(sceneObjects.GetAllObjects().size() == 0);
+  }
+  SECTION("Order of the objects after a deletion") {
+    gd::Object obj1("1");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+    ObjInstancesHolder& sceneObjects = scene.objectsInstances;
+    std::vector<RuntimeObject*> objects;
+    for (int i = 0; i < 4; ++i)
+      objects.push_back(sceneObjects.AddObject(
+          std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1))));
+
+    // The last object takes the place of the deleted one, the others keep
+    // their positions.
+    objects[1]->DeleteFromScene(scene);
+    const RuntimeObjNonOwningPtrList& list =
+        sceneObjects.GetObjectsRawPointers("1");
+    REQUIRE(list.size() == 3);
+    REQUIRE(list[0] == objects[0]);
+    REQUIRE(list[1] == objects[3]);
+    REQUIRE(list[2] == objects[2]);
+
+    // Deleting the last object does not move the others.
+    objects[2]->DeleteFromScene(scene);
+    REQUIRE(list.size() == 2);
+    REQUIRE(list[0] == objects[0]);
+    REQUIRE(list[1] == objects[3]);
+  }
+  SECTION("Deferred changes") {
+    gd::Object obj1("1");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+    ObjInstancesHolder& sceneObjects = scene.objectsInstances;
+    RuntimeObject* objA = sceneObjects.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1)));
+
+    sceneObjects.DeferChanges();
+    RuntimeObject* objB = sceneObjects.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, obj1)));
+    objA->DeleteFromScene(scene);
+    REQUIRE(sceneObjects.GetObjectsRawPointers("1").size() == 1);
+    REQUIRE(sceneObjects.GetObjectsRawPointers("1")[0] == objA);
+    REQUIRE(sceneObjects.GetAllObjects().size() == 1);
+
+    sceneObjects.ApplyDeferredChanges();
+    REQUIRE(sceneObjects.GetObjectsRawPointers("1").size() == 1);
+    REQUIRE(sceneObjects.GetObjectsRawPointers("1")[0] == objB);
+    REQUIRE(sceneObjects
+                .GetObjectsRawPointers(sceneObjects.GetDeletedObjectsSlot())
+                .size() == 1);
+    REQUIRE(sceneObjects.GetAllObjects().size() == 2);
+  }
 }
@@ -6,6 +6,7 @@
 /**
  * @file Tests covering common features of GDevelop C++ Platform.
  */
+#include <thread>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Layout.h"
@@ -32,9 +33,9 @@ TEST_CASE("ObjectsListsTools", "[game-engine]") {
   RuntimeObject obj2B(scene, obj2);
   RuntimeObject obj2C(scene, obj2);
   SECTION("PickObjectsIf") {
-    std::map<gd::String, std::vector<RuntimeObject*>*> map;
+    RuntimeObjectsLists map;
     std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
-    map["1"] = &list1;
+    map.Add(obj1.GetName(), list1);
 
     REQUIRE(PickObjectsIf(map, false, [](RuntimeObject*) { return true; }) ==
             true);
@@ -60,12 +61,12 @@ TEST_CASE("ObjectsListsTools", "[game-engine]") {
     REQUIRE(list1[0] == &obj1A);
   }
   SECTION("TwoObjectListsTest") {
-    std::map<gd::String, std::vector<RuntimeObject*>*> map1;
-    std::map<gd::String, std::vector<RuntimeObject*>*> map2;
+    RuntimeObjectsLists map1;
+    RuntimeObjectsLists map2;
     std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
     std::vector<RuntimeObject*> list2 = {&obj2A, &obj2B, &obj2C};
-    map1["1"] = &list1;
-    map2["2"] = &list2;
+    map1.Add(obj1.GetName(), list1);
+    map2.Add(obj2.GetName(), list2);
 
     REQUIRE(TwoObjectListsTest(
                 map1, map2, false, [](RuntimeObject*, RuntimeObject*) {
@@ -101,10 +102,110 @@ TEST_CASE("ObjectsListsTools", "[game-engine]") {
     REQUIRE(list1[0] == &obj1A);
     REQUIRE(list2[0] == &obj2C);
   }
+  SECTION("Nested picking") {
+    RuntimeObjectsLists map1;
+    RuntimeObjectsLists map2;
+    std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
+    std::vector<RuntimeObject*> list2 = {&obj2A, &obj2B, &obj2C};
+    map1.Add(obj1.GetName(), list1);
+    map2.Add(obj2.GetName(), list2);
+
+    // Picking flags of the outer test are not changed by the inner one.
+    REQUIRE(PickObjectsIf(map1, false, [&](RuntimeObject* obj) {
+              PickObjectsIf(map2, false, [&](RuntimeObject* obj2) {
+                return obj2 == &obj2B;
+              });
+              return obj == &obj1A || obj == &obj1C;
+            }) == true);
+    REQUIRE(list1.size() == 2);
+    REQUIRE(list1[1] == &obj1C);
+    REQUIRE(list2.size() == 1);
+    REQUIRE(list2[0] == &obj2B);
+  }
+  SECTION("TwoObjectListsTest with bounds") {
+    std::vector<std::unique_ptr<RuntimeObject>> objects;
+    std::vector<RuntimeObject*> list1;
+    std::vector<RuntimeObject*> list2;
+    for (std::size_t i = 0; i < 20; ++i) {
+      objects.emplace_back(new RuntimeObject(scene, obj1));
+      objects.back()->SetX(i * 100);
+      list1.push_back(objects.back().get());
+
+      objects.emplace_back(new RuntimeObject(scene, obj2));
+      objects.back()->SetX(i * 100 + (i % 2 ? 5 : 50));
+      list2.push_back(objects.back().get());
+    }
+    RuntimeObjectsLists map1;
+    RuntimeObjectsLists map2;
+    map1.Add(obj1.GetName(), list1);
+    map2.Add(obj2.GetName(), list2);
+
+    // Objects are 10 pixels wide squares, colliding when overlapping.
+    auto bounds = [](RuntimeObject* obj) {
+      return sf::FloatRect(obj->GetX(), obj->GetY(), 10, 10);
+    };
+    std::size_t predicateCalls = 0;
+    auto predicate = [&predicateCalls](RuntimeObject* obj1,
+                                       RuntimeObject* obj2) {
+      predicateCalls++;
+      return std::abs(obj1->GetX() - obj2->GetX()) < 10 &&
+             std::abs(obj1->GetY() - obj2->GetY()) < 10;
+    };
+
+    REQUIRE(TwoObjectListsTest(map1, map2, false, bounds, predicate) == true);
+    REQUIRE(predicateCalls < 20 * 20);
+    REQUIRE(list1.size() == 10);
+    REQUIRE(list2.size() == 10);
+    for (std::size_t i = 0; i < 10; ++i) {
+      REQUIRE(list1[i]->GetX() == (i * 2 + 1) * 100);
+      REQUIRE(list2[i]->GetX() == (i * 2 + 1) * 100 + 5);
+    }
+
+    SECTION("Inverted") {
+      std::vector<RuntimeObject*> list1;
+      std::vector<RuntimeObject*> list2;
+      for (std::size_t i = 0; i < objects.size(); ++i)
+        (i % 2 ? list2 : list1).push_back(objects[i].get());
+      map1.Add(obj1.GetName(), list1);
+      map2.Add(obj2.GetName(), list2);
+
+      REQUIRE(TwoObjectListsTest(map1, map2, true, bounds, predicate) ==
+              true);
+      REQUIRE(list1.size() == 10);
+      REQUIRE(list2.size() == 20);  // Second list is not filtered.
+      for (std::size_t i = 0; i < 10; ++i)
+        REQUIRE(list1[i]->GetX() == i * 2 * 100);
+    }
+
+    SECTION("Buffers are reused") {
+      const ObjectsBoundsGrid::Entry* entriesData = NULL;
+      {
+        ObjectsBoundsGrid boundsGrid;
+        entriesData = boundsGrid.GetEntries().data();
+      }
+      REQUIRE(entriesData != NULL);
+
+      // The next test uses the same entries, which are cleared.
+      {
+        ObjectsBoundsGrid boundsGrid;
+        REQUIRE(boundsGrid.GetEntries().data() == entriesData);
+        REQUIRE(boundsGrid.GetEntries().empty() == true);
+      }
+
+      // Other threads use their own entries.
+      const ObjectsBoundsGrid::Entry* otherThreadEntriesData = NULL;
+      std::thread otherThread([&otherThreadEntriesData]() {
+        ObjectsBoundsGrid boundsGrid;
+        otherThreadEntriesData = boundsGrid.GetEntries().data();
+      });
+      otherThread.join();
+      REQUIRE(otherThreadEntriesData != entriesData);
+    }
+  }
   SECTION("PickNearestObject") {
-    std::map<gd::String, std::vector<RuntimeObject*>*> map;
+    RuntimeObjectsLists map;
     std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
-    map["1"] = &list1;
+    map.Add(obj1.GetName(), list1);
     obj1A.SetX(50);
     obj1A.SetY(50);
     obj1B.SetX(160);
@@ -117,13 +218,64 @@ TEST_CASE("ObjectsListsTools", "[game-engine]") {
     REQUIRE(list1[0] == &obj1A);
 
     SECTION("Furthest") {
-      std::map<gd::String, std::vector<RuntimeObject*>*> map;
+      RuntimeObjectsLists map;
       std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
-      map["1"] = &list1;
+      map.Add(obj1.GetName(), list1);
 
       REQUIRE(PickNearestObject(map, 100, 90, true) == true);
       REQUIRE(list1.size() == 1);
       REQUIRE(list1[0] == &obj1C);
     }
   }
+  SECTION("RuntimeObjectsLists") {
+    RuntimeObjectsLists lists;
+    std::vector<RuntimeObject*> list1 = {&obj1A};
+    std::vector<RuntimeObject*> list2 = {&obj2A, &obj2B};
+    REQUIRE(lists.empty() == true);
+    REQUIRE(lists.Get("1") == NULL);
+
+    lists.Add(obj1.GetName(), list1);
+    lists.Add(obj2.GetName(), list2);
+    REQUIRE(lists.size() == 2);
+    REQUIRE(lists.Get("1") == &list1);
+    REQUIRE(lists.Get("2") == &list2);
+    REQUIRE(*lists.begin()->first == "1");
+
+    // Adding a list for the same objects replaces it.
+    gd::String sameName = "1";
+    lists.Add(sameName, list2);
+    REQUIRE(lists.size() == 2);
+    REQUIRE(lists.Get("1") == &list2);
+
+    // Lists are sorted by name, whatever the order they are added in.
+    {
+      RuntimeObjectsLists sorted;
+      sorted.Add(obj2.GetName(), list2);
+      sorted.Add(obj1.GetName(), list1);
+      REQUIRE(*sorted.begin()->first == "1");
+      REQUIRE(*(sorted.begin() + 1)->first == "2");
+    }
+
+    // Lists are still stored, and copied, when there are more than can be
+    // stored inline.
+    std::vector<gd::String> names;
+    for (std::size_t i = 0; i < RuntimeObjectsLists::InlineCapacity * 2; ++i)
+      names.push_back("Object" + gd::String::From(i));
+    for (std::size_t i = 0; i < names.size(); ++i) lists.Add(names[i], list1);
+
+    RuntimeObjectsLists copy = lists;
+    REQUIRE(copy.size() == names.size() + 2);
+    REQUIRE(copy.Get("2") == &list2);
+    REQUIRE(copy.Get(names.back()) == &list1);
+    std::size_t count = 0;
+    for (auto it = copy.begin(); it != copy.end(); ++it) {
+      if (it != copy.begin()) REQUIRE(*(it - 1)->first < *it->first);
+      count++;
+    }
+    REQUIRE(count == copy.size());
+
+    copy.clear();
+    REQUIRE(copy.empty() == true);
+    REQUIRE(lists.Get(names.front()) == &list1);
+  }
 }
@@ -0,0 +1,236 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering polygon collisions of GDevelop C++ Platform.
+ */
+#include "GDCpp/Runtime/PolygonCollision.h"
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <random>
+#include "GDCpp/Runtime/Polygon2d.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * The straightforward implementation of the separating axis theorem, used as
+ * a reference for the tests and the benchmark.
+ */
+CollisionResult ReferencePolygonCollisionTest(const Polygon2d& p1,
+                                              const Polygon2d& p2,
+                                              bool ignoreTouchingEdges) {
+  CollisionResult result;
+  result.collision = false;
+  result.move_axis = sf::Vector2f(0, 0);
+  if (p1.vertices.size() < 3 || p2.vertices.size() < 3) return result;
+
+  p1.ComputeEdges();
+  p2.ComputeEdges();
+
+  sf::Vector2f move_axis(0, 0);
+  float min_dist = FLT_MAX;
+  for (std::size_t i = 0; i < p1.vertices.size() + p2.vertices.size(); i++) {
+    sf::Vector2f edge = i < p1.vertices.size()
+                            ? p1.edges[i]
+                            : p2.edges[i - p1.vertices.size()];
+    sf::Vector2f axis(-edge.y, edge.x);
+    float length = sqrt(axis.x * axis.x + axis.y * axis.y);
+    if (length != 0.0f) axis = sf::Vector2f(axis.x / length, axis.y / length);
+
+    float minA = FLT_MAX, maxA = -FLT_MAX, minB = FLT_MAX, maxB = -FLT_MAX;
+    for (const sf::Vector2f& v : p1.vertices) {
+      minA = std::min(minA, axis.x * v.x + axis.y * v.y);
+      maxA = std::max(maxA, axis.x * v.x + axis.y * v.y);
+    }
+    for (const sf::Vector2f& v : p2.vertices) {
+      minB = std::min(minB, axis.x * v.x + axis.y * v.y);
+      maxB = std::max(maxB, axis.x * v.x + axis.y * v.y);
+    }
+
+    float dist = minA < minB ? minB - maxA : minA - maxB;
+    if (dist > 0.0f || (dist == 0.0 && ignoreTouchingEdges)) return result;
+
+    if (std::abs(dist) < min_dist) {
+      min_dist = std::abs(dist);
+      move_axis = axis;
+    }
+  }
+
+  sf::Vector2f d = p1.ComputeCenter() - p2.ComputeCenter();
+  if (d.x * move_axis.x + d.y * move_axis.y < 0.0f) move_axis = -move_axis;
+  result.collision = true;
+  result.move_axis = move_axis * min_dist;
+  return result;
+}
+
+Polygon2d CreateRectangle(float x, float y, float width, float height) {
+  Polygon2d rectangle = Polygon2d::CreateRectangle(width, height);
+  rectangle.Move(x + width / 2, y + height / 2);
+  return rectangle;
+}
+
+/**
+ * Create convex polygons (rotated rectangles and regular polygons) spread on
+ * an area, with some of them overlapping.
+ */
+std::vector<Polygon2d> CreateRandomPolygons(std::size_t count, float areaSize) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> position(0, areaSize);
+  std::uniform_real_distribution<float> size(8, 64);
+  std::uniform_real_distribution<float> angle(0, 6.28f);
+  std::uniform_int_distribution<int> verticesCount(3, 8);
+
+  std::vector<Polygon2d> polygons;
+  for (std::size_t i = 0; i < count; ++i) {
+    Polygon2d polygon;
+    if (i % 2 == 0) {
+      polygon = Polygon2d::CreateRectangle(size(generator), size(generator));
+    } else {
+      int n = verticesCount(generator);
+      float radius = size(generator) / 2;
+      for (int j = 0; j < n; ++j)
+        polygon.vertices.push_back(sf::Vector2f(radius * cos(j * 6.28f / n),
+                                                radius * sin(j * 6.28f / n)));
+    }
+    polygon.Rotate(angle(generator));
+    polygon.Move(position(generator), position(generator));
+    polygons.push_back(polygon);
+  }
+
+  return polygons;
+}
+}  // namespace
+
+TEST_CASE("PolygonCollision", "[game-engine]") {
+  SECTION("PolygonCollisionTest") {
+    Polygon2d rect1 = CreateRectangle(0, 0, 10, 10);
+    Polygon2d rect2 = CreateRectangle(8, 0, 10, 10);
+    Polygon2d rect3 = CreateRectangle(10, 0, 10, 10);
+    Polygon2d rect4 = CreateRectangle(30, 30, 10, 10);
+
+    CollisionResult result = PolygonCollisionTest(rect1, rect2);
+    REQUIRE(result.collision == true);
+    REQUIRE(result.move_axis.x == Approx(-2));
+    REQUIRE(result.move_axis.y == Approx(0));
+
+    REQUIRE(PolygonCollisionTest(rect1, rect3, false).collision == true);
+    REQUIRE(PolygonCollisionTest(rect1, rect3, true).collision == false);
+    REQUIRE(PolygonCollisionTest(rect1, rect4).collision == false);
+
+    // Results are the same as the reference implementation.
+    std::vector<Polygon2d> polygons = CreateRandomPolygons(200, 500);
+    std::size_t collisionsCount = 0;
+    for (std::size_t i = 0; i < polygons.size(); ++i) {
+      for (std::size_t j = 0; j < polygons.size(); ++j) {
+        CollisionResult result = PolygonCollisionTest(polygons[i], polygons[j]);
+        CollisionResult expected =
+            ReferencePolygonCollisionTest(polygons[i], polygons[j], false);
+        REQUIRE(result.collision == expected.collision);
+
+        // Only compare the distance to move, as the axis can be different
+        // when multiple axes give the same distance.
+        auto length = [](sf::Vector2f v) { return sqrt(v.x * v.x + v.y * v.y); };
+        REQUIRE(length(result.move_axis) ==
+                Approx(length(expected.move_axis)).epsilon(0.001));
+        if (result.collision) collisionsCount++;
+      }
+    }
+    REQUIRE(collisionsCount > polygons.size());
+  }
+  SECTION("IsPolygonCollidingWithAny") {
+    Polygon2d rect1 = CreateRectangle(0, 0, 10, 10);
+    std::vector<Polygon2d> others = {CreateRectangle(30, 30, 10, 10),
+                                     CreateRectangle(10, 0, 10, 10)};
+
+    REQUIRE(IsPolygonCollidingWithAny(rect1, others, false) == true);
+    REQUIRE(IsPolygonCollidingWithAny(rect1, others, true) == false);
+
+    others.push_back(CreateRectangle(5, 5, 10, 10));
+    REQUIRE(IsPolygonCollidingWithAny(rect1, others, true) == true);
+    REQUIRE(IsPolygonCollidingWithAny(rect1, {}, true) == false);
+  }
+  SECTION("IsPointInsidePolygon") {
+    Polygon2d rect = CreateRectangle(0, 0, 10, 10);
+    REQUIRE(IsPointInsidePolygon(rect, 5, 5) == true);
+    REQUIRE(IsPointInsidePolygon(rect, 15, 5) == false);
+  }
+  SECTION("PolygonRaycastTest") {
+    Polygon2d rect = CreateRectangle(0, 0, 10, 10);
+    RaycastResult result = PolygonRaycastTest(rect, -10, 5, 20, 5);
+    REQUIRE(result.collision == true);
+    REQUIRE(result.closePoint.x == Approx(0));
+    REQUIRE(result.farPoint.x == Approx(10));
+
+    REQUIRE(PolygonRaycastTest(rect, -10, 15, 20, 15).collision == false);
+  }
+}
+
+TEST_CASE("PolygonCollision benchmark", "[.][benchmark]") {
+  std::vector<Polygon2d> polygons = CreateRandomPolygons(1000, 2000);
+
+  auto measure = [&polygons](const char* name, std::function<bool(
+                                                   const Polygon2d&,
+                                                   const Polygon2d&)> test) {
+    std::size_t collisionsCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < polygons.size(); ++i) {
+      for (std::size_t j = 0; j < polygons.size(); ++j) {
+        if (test(polygons[i], polygons[j])) collisionsCount++;
+      }
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << name << ": " << duration.count() << "us for "
+              << polygons.size() * polygons.size() << " tests ("
+              << collisionsCount << " collisions)" << std::endl;
+    return collisionsCount;
+  };
+
+  std::size_t expected =
+      measure("Reference", [](const Polygon2d& p1, const Polygon2d& p2) {
+        return ReferencePolygonCollisionTest(p1, p2, false).collision;
+      });
+  REQUIRE(measure("PolygonCollisionTest",
+                  [](const Polygon2d& p1, const Polygon2d& p2) {
+                    return PolygonCollisionTest(p1, p2).collision;
+                  }) == expected);
+
+  // Test polygons against a list of others, stopping at the first collision.
+  std::vector<Polygon2d> others(polygons.begin() + polygons.size() / 2,
+                                polygons.end());
+  auto measureAny = [&polygons, &others](
+      const char* name,
+      std::function<bool(const Polygon2d&, const std::vector<Polygon2d>&)>
+          test) {
+    std::size_t collidingCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < polygons.size() / 2; ++i) {
+      if (test(polygons[i], others)) collidingCount++;
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << name << ": " << duration.count() << "us ("
+              << collidingCount << " colliding polygons)" << std::endl;
+    return collidingCount;
+  };
+
+  std::size_t expectedColliding = measureAny(
+      "Reference (any)",
+      [](const Polygon2d& polygon, const std::vector<Polygon2d>& others) {
+        for (const Polygon2d& other : others) {
+          if (ReferencePolygonCollisionTest(polygon, other, false).collision)
+            return true;
+        }
+        return false;
+      });
+  REQUIRE(measureAny("IsPolygonCollidingWithAny",
+                     [](const Polygon2d& polygon,
+                        const std::vector<Polygon2d>& others) {
+                       return IsPolygonCollidingWithAny(polygon, others);
+                     }) == expectedColliding);
+}
@@ -0,0 +1,139 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the preloading of resources of GDevelop C++ Platform.
+ */
+#include "GDCpp/Runtime/ResourcesPreloader.h"
+#include <algorithm>
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Project/ImageManager.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "catch.hpp"
+
+namespace {
+gd::SpriteObject CreateSpriteObject(const gd::String& name,
+                                    const std::vector<gd::String>& images) {
+  gd::SpriteObject object(name);
+  gd::Animation animation;
+  animation.SetDirectionsCount(1);
+  for (const gd::String& image : images) {
+    gd::Sprite sprite;
+    sprite.SetImageName(image);
+    animation.GetDirection(0).AddSprite(sprite);
+  }
+  object.AddAnimation(animation);
+  return object;
+}
+
+void AddResource(gd::SerializerElement& resourcesElement,
+                 const gd::String& name,
+                 const gd::String& kind) {
+  gd::SerializerElement& resourceElement =
+      resourcesElement.AddChild("resource");
+  resourceElement.SetAttribute("name", name);
+  resourceElement.SetAttribute("file", name);
+  resourceElement.SetAttribute("kind", kind);
+}
+}  // namespace
+
+TEST_CASE("ResourcesPreloader", "[game-engine][resources]") {
+  RuntimeGame game;
+  {
+    gd::SerializerElement element;
+    gd::SerializerElement& resourcesElement = element.AddChild("resources");
+    resourcesElement.ConsiderAsArrayOf("resource");
+    for (int i = 0; i < 20; ++i)
+      AddResource(
+          resourcesElement, "Image" + gd::String::From(i) + ".png", "image");
+    AddResource(resourcesElement, "Sound.wav", "audio");
+    game.GetResourcesManager().UnserializeFrom(element);
+  }
+  gd::ImageManager& imageManager = *game.GetImageManager();
+
+  SECTION("PreloadImages") {
+    std::vector<gd::String> images;
+    for (int i = 0; i < 20; ++i)
+      images.push_back("Image" + gd::String::From(i) + ".png");
+    images.push_back("Image3.png");
+    images.push_back("Sound.wav");
+    images.push_back("Unknown.png");
+
+    ResourcesPreloader preloader;
+    REQUIRE(preloader.GetProgress() == 1);
+    preloader.PreloadImages(images, game.GetResourcesManager(), imageManager);
+    REQUIRE(preloader.GetImagesCount() == 20);
+
+    preloader.Finish();
+    REQUIRE(preloader.GetLoadedImagesCount() == 20);
+    REQUIRE(preloader.GetProgress() == 1);
+    REQUIRE(preloader.Update() == true);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image0.png") == true);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image19.png") == true);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Sound.wav") == false);
+
+    // Images already loaded are not loaded again.
+    preloader.PreloadImages(images, game.GetResourcesManager(), imageManager);
+    REQUIRE(preloader.GetImagesCount() == 0);
+    REQUIRE(preloader.Update() == true);
+
+    // Textures are kept alive by the preloader until it is cleared.
+    preloader.Clear();
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image0.png") == false);
+  }
+  SECTION("Release the textures") {
+    std::vector<gd::String> images = {"Image0.png", "Image1.png"};
+
+    ResourcesPreloader preloader;
+    preloader.PreloadImages(images, game.GetResourcesManager(), imageManager);
+    preloader.Finish();
+    std::shared_ptr<SFMLTextureWrapper> usedTexture =
+        imageManager.GetSFMLTexture("Image0.png");
+
+    // Only the textures used by something else stay loaded.
+    preloader.ReleaseTextures();
+    REQUIRE(preloader.GetLoadedImagesCount() == 2);
+    REQUIRE(preloader.GetProgress() == 1);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image0.png") == true);
+    REQUIRE(imageManager.HasLoadedSFMLTexture("Image1.png") == false);
+  }
+  SECTION("Stop preloading") {
+    std::vector<gd::String> images;
+    for (int i = 0; i < 20; ++i)
+      images.push_back("Image" + gd::String::From(i) + ".png");
+
+    ResourcesPreloader preloader;
+    preloader.PreloadImages(images, game.GetResourcesManager(), imageManager);
+    preloader.Update();
+    preloader.Clear();
+    REQUIRE(preloader.GetImagesCount() == 0);
+    REQUIRE(preloader.Update() == true);
+  }
+  SECTION("GetImagesUsedByInstances") {
+    gd::Layout layout;
+    layout.InsertObject(CreateSpriteObject("Player", {"Image0.png", "Image1.png"}),
+                        0);
+    layout.InsertObject(CreateSpriteObject("Unused", {"Image2.png"}), 0);
+    game.InsertObject(CreateSpriteObject("Enemy", {"Image3.png"}), 0);
+
+    gd::SerializerElement instancesElement;
+    instancesElement.ConsiderAsArrayOf("instance");
+    for (const char* name : {"Player", "Player", "Enemy", "Unknown"})
+      instancesElement.AddChild("instance").SetAttribute("name", name);
+    gd::InitialInstancesContainer instances;
+    instances.UnserializeFrom(instancesElement);
+
+    std::vector<gd::String> images =
+        ResourcesPreloader::GetImagesUsedByInstances(game, layout, instances);
+    std::sort(images.begin(), images.end());
+    REQUIRE(images ==
+            std::vector<gd::String>({"Image0.png", "Image1.png", "Image3.png"}));
+  }
+}
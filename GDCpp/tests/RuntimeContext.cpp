@@ -0,0 +1,65 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the RuntimeContext used by events of GDevelop C++
+ * Platform.
+ */
+#include "GDCpp/Runtime/RuntimeContext.h"
+#include "catch.hpp"
+
+TEST_CASE("RuntimeContext", "[game-engine][events]") {
+  SECTION("TriggerOnce") {
+    RuntimeContext context(NULL);
+
+    context.StartNewFrame();
+    REQUIRE(context.TriggerOnce(0) == true);
+    REQUIRE(context.TriggerOnce(5) == true);
+
+    context.StartNewFrame();
+    REQUIRE(context.TriggerOnce(0) == false);
+    REQUIRE(context.TriggerOnce(1) == true);
+
+    context.StartNewFrame();  // 5 was not triggered during the last frame.
+    REQUIRE(context.TriggerOnce(5) == true);
+    REQUIRE(context.TriggerOnce(1) == false);
+
+    context.StartNewFrame();
+    context.StartNewFrame();
+    REQUIRE(context.TriggerOnce(1) == true);
+    REQUIRE(context.TriggerOnce(5) == true);
+  }
+  SECTION("TriggerOnce with the conditions of events generated code") {
+    RuntimeTriggerOnceConditions sceneConditions(3);
+    RuntimeTriggerOnceConditions externalEventsConditions(2);
+    RuntimeContext context(NULL);
+    RuntimeContext otherContext(NULL);
+
+    context.StartNewFrame();
+    REQUIRE(context.TriggerOnce(sceneConditions, 2) == true);
+    REQUIRE(context.TriggerOnce(externalEventsConditions, 0) == true);
+    REQUIRE(sceneConditions.offset == 0);
+    REQUIRE(externalEventsConditions.offset == 3);
+
+    // The conditions of each events code are not mixed.
+    context.StartNewFrame();
+    REQUIRE(context.TriggerOnce(sceneConditions, 0) == true);
+    REQUIRE(context.TriggerOnce(externalEventsConditions, 0) == false);
+    REQUIRE(context.TriggerOnce(sceneConditions, 2) == false);
+
+    // Each context has its own conditions.
+    otherContext.StartNewFrame();
+    REQUIRE(otherContext.TriggerOnce(externalEventsConditions, 1) == true);
+    REQUIRE(externalEventsConditions.offset == 0);
+    otherContext.StartNewFrame();
+    REQUIRE(otherContext.TriggerOnce(externalEventsConditions, 1) == false);
+    REQUIRE(otherContext.TriggerOnce(sceneConditions, 2) == true);
+
+    context.StartNewFrame();
+    REQUIRE(context.TriggerOnce(externalEventsConditions, 0) == false);
+    REQUIRE(context.TriggerOnce(sceneConditions, 0) == false);
+    REQUIRE(externalEventsConditions.offset == 3);
+  }
+}
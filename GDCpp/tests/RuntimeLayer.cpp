@@ -0,0 +1,43 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering RuntimeLayer and RuntimeCamera classes.
+ */
+#include "GDCpp/Runtime/RuntimeLayer.h"
+#include <cmath>
+#include "catch.hpp"
+
+TEST_CASE("RuntimeCamera", "[game-engine]") {
+  SECTION("Visible area") {
+    RuntimeCamera camera;
+    camera.SetSize(800, 600);
+    sf::FloatRect area = camera.GetVisibleArea();
+    REQUIRE(area.width == Approx(800));
+    REQUIRE(area.height == Approx(600));
+    REQUIRE((area.left + area.width / 2) ==
+            Approx(camera.GetViewCenter().x));
+    REQUIRE((area.top + area.height / 2) ==
+            Approx(camera.GetViewCenter().y));
+
+    camera.SetZoom(2);
+    area = camera.GetVisibleArea();
+    REQUIRE(area.width == Approx(400));
+    REQUIRE(area.height == Approx(300));
+
+    // The area contains the whole rotated view.
+    camera.SetRotation(90);
+    area = camera.GetVisibleArea();
+    REQUIRE(area.width == Approx(300));
+    REQUIRE(area.height == Approx(400));
+
+    camera.SetRotation(45);
+    area = camera.GetVisibleArea();
+    REQUIRE(area.width == Approx(700 / std::sqrt(2.0)));
+    REQUIRE(area.height == Approx(700 / std::sqrt(2.0)));
+    REQUIRE((area.left + area.width / 2) ==
+            Approx(camera.GetViewCenter().x));
+  }
+}
@@ -0,0 +1,85 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the behaviors of RuntimeObject.
+ */
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+namespace {
+void AddBehavior(gd::Object& object, const gd::String& name) {
+  gd::Behavior* behavior = new gd::Behavior;
+  behavior->SetName(name);
+  object.AddBehavior(behavior);
+}
+}  // namespace
+
+TEST_CASE("RuntimeObject", "[game-engine]") {
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+
+  gd::Object player("Player");
+  AddBehavior(player, "Platformer");
+  AddBehavior(player, "Anchor");
+  gd::Object enemy("Enemy");
+  AddBehavior(enemy, "Platformer");
+
+  SECTION("Behaviors by name") {
+    RuntimeObject object(scene, player);
+    REQUIRE(object.HasBehaviorNamed("Platformer") == true);
+    REQUIRE(object.HasBehaviorNamed("Anchor") == true);
+    REQUIRE(object.HasBehaviorNamed("Unknown") == false);
+    REQUIRE(object.GetBehaviorRawPointer("Platformer")->GetName() ==
+            "Platformer");
+    REQUIRE(object.GetBehaviorRawPointer("Unknown") == NULL);
+
+    RuntimeObject copy(object);
+    REQUIRE(copy.GetBehaviorRawPointer("Anchor") !=
+            object.GetBehaviorRawPointer("Anchor"));
+    REQUIRE(copy.GetBehaviorRawPointer("Anchor")->GetName() == "Anchor");
+  }
+
+  SECTION("Behaviors names are shared by the objects of the same type") {
+    RuntimeObject player1(scene, player);
+    RuntimeObject player2(scene, player);
+    REQUIRE(scene.GetBehaviorsNames(player) == scene.GetBehaviorsNames(player));
+    REQUIRE(scene.GetBehaviorsNames(player) != scene.GetBehaviorsNames(enemy));
+
+    // Behaviors changed since the names were resolved are taken into account.
+    gd::Object changedPlayer("Player");
+    AddBehavior(changedPlayer, "Platformer");
+    RuntimeObject player3(scene, changedPlayer);
+    REQUIRE(player3.HasBehaviorNamed("Anchor") == false);
+  }
+
+  SECTION("Behavior slots") {
+    RuntimeObject player1(scene, player);
+    RuntimeObject player2(scene, player);
+    RuntimeObject enemy1(scene, enemy);
+
+    RuntimeBehaviorSlot slot("Platformer");
+    REQUIRE(player1.GetBehaviorRawPointer(slot) ==
+            player1.GetBehaviorRawPointer("Platformer"));
+    std::size_t behaviorsNamesId = slot.behaviorsNamesId;
+    REQUIRE(player2.GetBehaviorRawPointer(slot) ==
+            player2.GetBehaviorRawPointer("Platformer"));
+    REQUIRE(slot.behaviorsNamesId == behaviorsNamesId);
+
+    // The slot is resolved again for objects of another type.
+    REQUIRE(enemy1.GetBehaviorRawPointer(slot) ==
+            enemy1.GetBehaviorRawPointer("Platformer"));
+    REQUIRE(slot.behaviorsNamesId != behaviorsNamesId);
+    REQUIRE(player1.GetBehaviorRawPointer(slot) ==
+            player1.GetBehaviorRawPointer("Platformer"));
+
+    RuntimeBehaviorSlot anchorSlot("Anchor");
+    REQUIRE(player1.GetBehaviorRawPointer(anchorSlot) != NULL);
+    REQUIRE(enemy1.GetBehaviorRawPointer(anchorSlot) == NULL);
+  }
+}
@@ -0,0 +1,165 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the recycling of the objects deleted from a scene.
+ */
+#include "GDCpp/Runtime/RuntimeObjectsPool.h"
+#include <SFML/Graphics.hpp>
+#include <thread>
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Project/ImageManager.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCpp/Runtime/Project/Behavior.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/RuntimeSpriteObject.h"
+#include "catch.hpp"
+
+namespace {
+int behaviorsCount = 0;
+
+class CountedBehavior : public gd::Behavior {
+ public:
+  CountedBehavior() { behaviorsCount++; }
+  CountedBehavior(const CountedBehavior& other) : gd::Behavior(other) {
+    behaviorsCount++;
+  }
+  virtual ~CountedBehavior() { behaviorsCount--; }
+  virtual gd::Behavior* Clone() const { return new CountedBehavior(*this); }
+};
+}  // namespace
+
+TEST_CASE("RuntimeObjectsPool", "[game-engine]") {
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+  RuntimeObjectsPool pool;
+
+  gd::SpriteObject sprite("Sprite");
+  gd::Variable life;
+  life.SetValue(10);
+  sprite.GetVariables().Insert("Life", life, 0);
+  CountedBehavior* behavior = new CountedBehavior;
+  behavior->SetName("Counted");
+  sprite.AddBehavior(behavior);
+
+  SECTION("Objects are reset when reused") {
+    std::unique_ptr<RuntimeObject> object(
+        new RuntimeSpriteObject(scene, sprite));
+    RuntimeObject* objectPtr = object.get();
+    REQUIRE(behaviorsCount == 2);
+    object->SetX(42);
+    object->SetLayer("Layer");
+    object->GetVariables().Get("Life").SetValue(3);
+    object->GetVariables().Get("Other").SetValue(1);
+    static_cast<RuntimeSpriteObject*>(object.get())->SetOpacity(0);
+    object->DeleteFromScene(scene);
+
+    // The behaviors are destroyed as soon as the object is recycled.
+    pool.Recycle(std::move(object));
+    REQUIRE(pool.GetRecycledObjectsCount("Sprite") == 1);
+    REQUIRE(behaviorsCount == 1);
+
+    std::unique_ptr<RuntimeObject> newObject = pool.CreateObject(scene, sprite);
+    REQUIRE(newObject.get() == objectPtr);
+    REQUIRE(pool.GetRecycledObjectsCount("Sprite") == 0);
+    REQUIRE(behaviorsCount == 2);
+    REQUIRE(newObject->GetName() == "Sprite");
+    REQUIRE(newObject->GetX() == 0);
+    REQUIRE(newObject->GetLayer() == "");
+    REQUIRE(newObject->GetVariables().Get("Life").GetValue() == 10);
+    REQUIRE(newObject->GetVariables().Has("Other") == false);
+    REQUIRE(newObject->HasBehaviorNamed("Counted") == true);
+    REQUIRE(static_cast<RuntimeSpriteObject*>(newObject.get())
+                ->GetOpacity() == 255);
+  }
+
+  SECTION("Images modified by an object are not kept when it is reused") {
+    auto red = std::make_shared<SFMLTextureWrapper>();
+    red->image.create(2, 2, sf::Color::Red);
+    red->texture.loadFromImage(red->image);
+    scene.GetImageManager()->SetSFMLTexture("Red.png", red);
+    auto blue = std::make_shared<SFMLTextureWrapper>();
+    blue->image.create(2, 2, sf::Color::Blue);
+    blue->texture.loadFromImage(blue->image);
+    scene.GetImageManager()->SetSFMLTexture("Blue.png", blue);
+
+    gd::Animation anim;
+    gd::Sprite redSprite;
+    redSprite.SetImageName("Red.png");
+    anim.SetDirectionsCount(1);
+    anim.GetDirection(0).AddSprite(redSprite);
+    sprite.AddAnimation(anim);
+
+    std::unique_ptr<RuntimeObject> object(
+        new RuntimeSpriteObject(scene, sprite));
+    RuntimeObject* objectPtr = object.get();
+    static_cast<RuntimeSpriteObject*>(object.get())
+        ->CopyImageOnImageOfCurrentSprite(scene, "Blue.png", 0, 0, false);
+    REQUIRE(static_cast<RuntimeSpriteObject*>(object.get())
+                ->GetCurrentSprite()
+                .GetSFMLTexture() != red);
+    object->DeleteFromScene(scene);
+    pool.Recycle(std::move(object));
+
+    std::unique_ptr<RuntimeObject> newObject = pool.CreateObject(scene, sprite);
+    REQUIRE(newObject.get() == objectPtr);
+    const gd::Sprite& newSprite =
+        static_cast<RuntimeSpriteObject*>(newObject.get())->GetCurrentSprite();
+    REQUIRE(newSprite.GetSFMLTexture() == red);
+    REQUIRE(newSprite.GetSFMLTexture()->image.getPixel(0, 0) == sf::Color::Red);
+  }
+
+  SECTION("Only the objects able to be recycled are kept") {
+    gd::Object object("Object");
+    pool.Recycle(std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, object)));
+    REQUIRE(pool.GetRecycledObjectsCount("Object") == 0);
+
+    pool.SetMaxObjectsCount(2);
+    for (int i = 0; i < 3; ++i)
+      pool.Recycle(std::unique_ptr<RuntimeObject>(
+          new RuntimeSpriteObject(scene, sprite)));
+    REQUIRE(pool.GetRecycledObjectsCount("Sprite") == 2);
+
+    pool.Clear();
+    REQUIRE(pool.GetRecycledObjectsCount("Sprite") == 0);
+  }
+
+  SECTION("Objects can be created and recycled by several threads") {
+    gd::SpriteObject threadedSprite("ThreadedSprite");
+    for (int t = 0; t < 4; ++t)
+      pool.Recycle(std::unique_ptr<RuntimeObject>(
+          new RuntimeSpriteObject(scene, threadedSprite)));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+      threads.push_back(std::thread([&pool, &scene, &threadedSprite]() {
+        for (int i = 0; i < 100; ++i)
+          pool.Recycle(pool.CreateObject(scene, threadedSprite));
+      }));
+    }
+    for (auto& thread : threads) thread.join();
+
+    // Each thread always reused one of the recycled objects.
+    REQUIRE(pool.GetRecycledObjectsCount("ThreadedSprite") == 4);
+  }
+
+  SECTION("Objects deleted from the scene are recycled") {
+    for (int i = 0; i < 3; ++i)
+      scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(
+          new RuntimeSpriteObject(scene, sprite)));
+    scene.objectsInstances.GetObjectsRawPointers("Sprite")[0]->DeleteFromScene(
+        scene);
+    scene.objectsInstances.GetObjectsRawPointers("Sprite")[0]->DeleteFromScene(
+        scene);
+
+    scene.objectsInstances.FlushDeletedObjects(pool);
+    REQUIRE(scene.objectsInstances.GetAllObjects().size() == 1);
+    REQUIRE(pool.GetRecycledObjectsCount("Sprite") == 2);
+  }
+}
@@ -7,12 +7,15 @@
  * @file Tests covering common features of GDevelop C++ Platform.
  */
 #include "GDCpp/Runtime/RuntimeSpriteObject.h"
+#include <SFML/Graphics.hpp>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
 #include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Project/ImageManager.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/Collisions.h"
 #include "GDCpp/Runtime/RuntimeGame.h"
 #include "GDCpp/Runtime/RuntimeObject.h"
 #include "GDCpp/Runtime/RuntimeObjectsListsTools.h"
@@ -29,6 +32,13 @@ TEST_CASE("RuntimeSpriteObject", "[game-engine]") {
     anim.SetName("First animation");
     gd::Sprite sprite;
     sprite.SetImageName("Image.png");
+    Polygon2d mask;
+    mask.vertices = {sf::Vector2f(0, 0),
+                     sf::Vector2f(10, 0),
+                     sf::Vector2f(10, 10),
+                     sf::Vector2f(0, 10)};
+    sprite.SetCustomCollisionMask({mask});
+    sprite.SetCollisionMaskAutomatic(false);
     anim.SetDirectionsCount(1);
     anim.GetDirection(0).AddSprite(sprite);
     obj1.AddAnimation(anim);
@@ -60,6 +70,24 @@ TEST_CASE("RuntimeSpriteObject", "[game-engine]") {
     object.SetAngle(42);
     REQUIRE(object.GetAngle() == 42);
   }
+  SECTION("Hitboxes") {
+    const std::vector<Polygon2d>& hitBoxes = object.GetHitBoxes();
+    REQUIRE(hitBoxes.size() == 1);
+    REQUIRE(hitBoxes[0].vertices[2] == sf::Vector2f(10, 10));
+
+    // Hitboxes are updated when the object is moved.
+    object.SetX(5);
+    object.SetY(7);
+    REQUIRE(&object.GetHitBoxes() == &hitBoxes);
+    REQUIRE(hitBoxes[0].vertices[0] == sf::Vector2f(5, 7));
+    REQUIRE(hitBoxes[0].vertices[2] == sf::Vector2f(15, 17));
+
+    // ...or when the animation is changed.
+    object.SetCurrentAnimation(1);
+    REQUIRE(object.GetHitBoxes()[0].vertices[2] != sf::Vector2f(15, 17));
+    object.SetCurrentAnimation(0);
+    REQUIRE(object.GetHitBoxes()[0].vertices[2] == sf::Vector2f(15, 17));
+  }
   SECTION("Animations") {
     REQUIRE(object.GetCurrentAnimation() == 0);
     REQUIRE(object.GetCurrentAnimationName() == "First animation");
@@ -85,5 +113,117 @@ TEST_CASE("RuntimeSpriteObject", "[game-engine]") {
       REQUIRE(object.GetCurrentAnimation() == 0);
       REQUIRE(object.GetCurrentAnimationName() == "First animation");
     }
+
+    SECTION("The sprite shared by objects without a valid sprite is unchanged") {
+      object.SetCurrentAnimation(2);
+      object.SetX(42);
+      object.SetAngle(90);
+      REQUIRE(object.GetCurrentSFMLSprite().getPosition() ==
+              sf::Vector2f(0, 0));
+      REQUIRE(object.GetCurrentSFMLSprite().getRotation() == 0);
+    }
+  }
+  SECTION("Images modified by the object in a texture atlas") {
+    // A 4x2 atlas, the sprite displaying its 2x2 right half.
+    auto atlas = std::make_shared<SFMLTextureWrapper>();
+    atlas->image.create(4, 2, sf::Color::Red);
+    atlas->texture.loadFromImage(atlas->image);
+    scene.GetImageManager()->SetSFMLTexture("Atlas.png", atlas);
+    auto blue = std::make_shared<SFMLTextureWrapper>();
+    blue->image.create(2, 2, sf::Color::Blue);
+    blue->texture.loadFromImage(blue->image);
+    scene.GetImageManager()->SetSFMLTexture("Blue.png", blue);
+
+    gd::SpriteObject atlasObject("AtlasObject");
+    gd::Animation anim;
+    gd::Sprite sprite;
+    sprite.SetImageName("Atlas.png");
+    sprite.SetImageRect(2, 0, 2, 2);
+    anim.SetDirectionsCount(1);
+    anim.GetDirection(0).AddSprite(sprite);
+    atlasObject.AddAnimation(anim);
+    RuntimeSpriteObject object(scene, atlasObject);
+
+    // Only the part of the atlas displayed by the sprite is copied.
+    object.CopyImageOnImageOfCurrentSprite(scene, "Blue.png", 1, 1, false);
+    const SFMLTextureWrapper& image =
+        *object.GetCurrentSprite().GetSFMLTexture();
+    REQUIRE(image.texture.getSize() == sf::Vector2u(2, 2));
+    REQUIRE(object.GetCurrentSFMLSprite().getTextureRect() ==
+            sf::IntRect(0, 0, 2, 2));
+    REQUIRE(image.image.getPixel(0, 0) == sf::Color::Red);
+    REQUIRE(image.image.getPixel(1, 1) == sf::Color::Blue);
+
+    // The atlas itself is not modified.
+    REQUIRE(atlas->image.getPixel(3, 1) == sf::Color::Red);
+  }
+  SECTION("Pixel perfect collisions of sprites packed in a texture atlas") {
+    // A 8x2 atlas with four 2x2 sprites: transparent, red, red, transparent.
+    auto atlas = std::make_shared<SFMLTextureWrapper>();
+    atlas->image.create(8, 2, sf::Color::Transparent);
+    for (unsigned int x = 2; x < 6; ++x)
+      for (unsigned int y = 0; y < 2; ++y)
+        atlas->image.setPixel(x, y, sf::Color::Red);
+    atlas->texture.loadFromImage(atlas->image);
+    scene.GetImageManager()->SetSFMLTexture("Atlas.png", atlas);
+
+    auto createObject = [&scene](const gd::String& name, int left) {
+      gd::SpriteObject spriteObject(name);
+      gd::Animation anim;
+      gd::Sprite sprite;
+      sprite.SetImageName("Atlas.png");
+      sprite.SetImageRect(left, 0, 2, 2);
+      anim.SetDirectionsCount(1);
+      anim.GetDirection(0).AddSprite(sprite);
+      spriteObject.AddAnimation(anim);
+      return std::unique_ptr<RuntimeSpriteObject>(
+          new RuntimeSpriteObject(scene, spriteObject));
+    };
+    std::unique_ptr<RuntimeSpriteObject> first = createObject("First", 2);
+    std::unique_ptr<RuntimeSpriteObject> second = createObject("Second", 4);
+    std::unique_ptr<RuntimeSpriteObject> transparent =
+        createObject("Transparent", 6);
+
+    // The pixels of the sprites are read in their parts of the atlas.
+    REQUIRE(CheckCollision(first.get(), second.get()) == true);
+    REQUIRE(CheckCollision(first.get(), transparent.get()) == false);
+
+    second->SetX(2);
+    REQUIRE(CheckCollision(first.get(), second.get()) == false);
+  }
+  SECTION("Size of the textures used by the scene") {
+    auto atlas = std::make_shared<SFMLTextureWrapper>();
+    atlas->image.create(4, 2, sf::Color::Red);
+    atlas->texture.loadFromImage(atlas->image);
+    scene.GetImageManager()->SetSFMLTexture("Atlas.png", atlas);
+    REQUIRE(scene.GetTexturesSize() == 0);
+
+    gd::SpriteObject atlasObject("AtlasObject");
+    gd::Animation anim;
+    gd::Sprite sprite;
+    sprite.SetImageName("Atlas.png");
+    anim.SetDirectionsCount(1);
+    anim.GetDirection(0).AddSprite(sprite);
+    anim.GetDirection(0).AddSprite(sprite);
+    atlasObject.AddAnimation(anim);
+    scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(
+        new RuntimeSpriteObject(scene, atlasObject)));
+    scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(
+        new RuntimeSpriteObject(scene, atlasObject)));
+
+    // The atlas is counted once, even if used by several sprites and objects.
+    REQUIRE(scene.GetTexturesSize() == 4 * 2 * 4);
+
+    // Textures loaded after the scene are counted too.
+    auto blue = std::make_shared<SFMLTextureWrapper>();
+    blue->image.create(2, 2, sf::Color::Blue);
+    blue->texture.loadFromImage(blue->image);
+    scene.GetImageManager()->SetSFMLTexture("Blue.png", blue);
+    gd::SpriteObject blueObject("BlueObject");
+    anim.GetDirection(0).GetSprite(0).SetImageName("Blue.png");
+    blueObject.AddAnimation(anim);
+    scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(
+        new RuntimeSpriteObject(scene, blueObject)));
+    REQUIRE(scene.GetTexturesSize() == 4 * 2 * 4 + 2 * 2 * 4);
   }
 }
@@ -7,6 +7,8 @@
  * @file Tests covering scene stacking of GDevelop C++ Platform.
  */
 #include "GDCpp/Runtime/SceneStack.h"
+#include <chrono>
+#include <thread>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Layout.h"
@@ -59,4 +61,46 @@ TEST_CASE("SceneStack", "[game-engine]") {
     });
     stack.Replace("Scene 1", true);
   }
+
+  SECTION("Preload") {
+    stack.Push("Scene 1");
+    stack.Preload("Scene 2");
+    stack.Preload("Scene 3");  // Not existing, ignored.
+
+    bool sceneLoaded = false;
+    stack.OnLoadScene([&sceneLoaded](RuntimeScene& scene) {
+      sceneLoaded = scene.GetName() == "Scene 2";
+      return true;
+    });
+    auto scene2 = stack.Replace("Scene 2");
+    REQUIRE(scene2 != nullptr);
+    REQUIRE(scene2->GetName() == "Scene 2");
+    REQUIRE(sceneLoaded == true);
+    REQUIRE(stack.IsPreloaded("Scene 2") == false);
+
+    // The preloaded scene is taken, and its textures created, by Step.
+    stack.OnLoadScene([](RuntimeScene& scene) { return true; });
+    stack.Preload("Scene 1");
+    for (int i = 0; i < 500 && !stack.IsPreloaded("Scene 1"); ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      REQUIRE(stack.Step() == true);
+    }
+    REQUIRE(stack.IsPreloaded("Scene 1") == true);
+    REQUIRE(stack.IsPreloaded("Scene 2") == false);
+
+    auto scene1 = stack.Push("Scene 1");
+    REQUIRE(scene1->GetName() == "Scene 1");
+    REQUIRE(stack.Pop().get() == scene1);
+
+    // Preloading another scene does not wait for the previous preload.
+    stack.Preload("Scene 1");
+    stack.Preload("Scene 2");
+    REQUIRE(stack.Step() == true);
+    auto otherScene2 = stack.Push("Scene 2");
+    REQUIRE(otherScene2 != nullptr);
+    REQUIRE(otherScene2->GetName() == "Scene 2");
+
+    // A scene preloaded but not used is discarded with the stack.
+    stack.Preload("Scene 1");
+  }
 }
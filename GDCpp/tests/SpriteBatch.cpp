@@ -0,0 +1,80 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering SpriteBatch class.
+ */
+#include "GDCpp/Runtime/SpriteBatch.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+TEST_CASE("SpriteBatch", "[game-engine]") {
+  SECTION("Sprites with the same texture are drawn together") {
+    sf::RenderTexture renderTarget;
+    sf::Texture texture1, texture2;
+
+    SpriteBatch batch;
+    batch.Add(renderTarget,
+              &texture1,
+              sf::BlendAlpha,
+              sf::Transform(),
+              sf::IntRect(0, 0, 32, 32),
+              sf::Color::White);
+    batch.Add(renderTarget,
+              &texture1,
+              sf::BlendAlpha,
+              sf::Transform(),
+              sf::IntRect(32, 0, 32, 32),
+              sf::Color::White);
+    REQUIRE(batch.GetVertexCount() == 12);
+    REQUIRE(batch.GetDrawCallsCount() == 0);
+
+    batch.Add(renderTarget,
+              &texture2,
+              sf::BlendAlpha,
+              sf::Transform(),
+              sf::IntRect(0, 0, 32, 32),
+              sf::Color::White);
+    REQUIRE(batch.GetVertexCount() == 6);
+    REQUIRE(batch.GetDrawCallsCount() == 1);
+
+    // Nothing is drawn without a texture.
+    batch.Add(renderTarget,
+              NULL,
+              sf::BlendAlpha,
+              sf::Transform(),
+              sf::IntRect(0, 0, 32, 32),
+              sf::Color::White);
+    REQUIRE(batch.GetVertexCount() == 6);
+
+    batch.Flush(renderTarget);
+    REQUIRE(batch.GetVertexCount() == 0);
+    REQUIRE(batch.GetDrawCallsCount() == 2);
+    batch.Flush(renderTarget);
+    REQUIRE(batch.GetDrawCallsCount() == 2);
+  }
+  SECTION("Objects that are not sprites draw the batch") {
+    gd::Object object("MyObject");
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+    RuntimeObject runtimeObject(scene, object);
+
+    sf::RenderTexture renderTarget;
+    sf::Texture texture;
+    SpriteBatch batch;
+    batch.Add(renderTarget,
+              &texture,
+              sf::BlendAlpha,
+              sf::Transform(),
+              sf::IntRect(0, 0, 32, 32),
+              sf::Color::White);
+    runtimeObject.DrawInBatch(renderTarget, batch);
+    REQUIRE(batch.GetVertexCount() == 0);
+    REQUIRE(batch.GetDrawCallsCount() == 1);
+  }
+}
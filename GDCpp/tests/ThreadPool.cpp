@@ -0,0 +1,42 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the ThreadPool of GDevelop C++ Platform.
+ */
+#include "GDCpp/Runtime/ThreadPool.h"
+#include <atomic>
+#include "catch.hpp"
+
+TEST_CASE("ThreadPool", "[common]") {
+  SECTION("ParallelFor") {
+    ThreadPool pool(4);
+    REQUIRE(pool.GetThreadsCount() == 4);
+
+    std::vector<std::atomic<int>> processed(1000);
+    for (int run = 0; run < 10; ++run) {
+      pool.ParallelFor(
+          processed.size(), 7, [&processed](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) processed[i]++;
+          });
+    }
+
+    bool allProcessedOnce = true;
+    for (auto& count : processed)
+      if (count != 10) allProcessedOnce = false;
+    REQUIRE(allProcessedOnce == true);
+  }
+  SECTION("Without threads") {
+    ThreadPool pool(1);
+    REQUIRE(pool.GetThreadsCount() == 1);
+
+    std::size_t processedCount = 0;
+    pool.ParallelFor(
+        100, 10, [&processedCount](std::size_t begin, std::size_t end) {
+          processedCount += end - begin;
+        });
+    REQUIRE(processedCount == 100);
+  }
+}
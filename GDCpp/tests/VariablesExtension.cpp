@@ -0,0 +1,156 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the variables actions and conditions of GDevelop C++
+ * Platform.
+ */
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include "GDCore/Project/Variable.h"
+#include "GDCpp/Extensions/Builtin/RuntimeSceneTools.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * The variable converting its content each time it is used as another type
+ * than the last one, used as a reference for the benchmark.
+ */
+class ReferenceVariable {
+ public:
+  ReferenceVariable() : value(0), isNumber(true){};
+
+  const gd::String& GetString() const {
+    if (isNumber) {
+      str = gd::String::From(value);
+      isNumber = false;
+    }
+    return str;
+  }
+  void SetString(const gd::String& newStr) {
+    str = newStr;
+    isNumber = false;
+  }
+  double GetValue() const {
+    if (!isNumber) {
+      value = str.To<double>();
+      isNumber = true;
+    }
+    return value;
+  }
+  void SetValue(double val) {
+    value = val;
+    isNumber = true;
+  }
+
+  void operator=(double val) { SetValue(val); };
+  void operator+=(double val) { SetValue(val + GetValue()); }
+  bool operator>(double val) const { return GetValue() > val; };
+  void operator=(const gd::String& val) { SetString(val); };
+  void operator+=(const gd::String& val) { SetString(GetString() + val); }
+
+ private:
+  mutable double value;
+  mutable gd::String str;
+  mutable bool isNumber;
+};
+
+ReferenceVariable& ReturnVariable(ReferenceVariable& variable) {
+  return variable;
+}
+const gd::String& GetVariableString(const ReferenceVariable& variable) {
+  return variable.GetString();
+}
+double GetVariableValue(const ReferenceVariable& variable) {
+  return variable.GetValue();
+}
+using ::GetVariableString;
+using ::GetVariableValue;
+using ::ReturnVariable;
+
+/**
+ * Run the code that events typically generate for a score displayed in a
+ * text and a name built from strings and numbers.
+ */
+template <class T>
+std::size_t RunVariablesEvents(T& score, T& name, std::size_t framesCount) {
+  std::size_t textLength = 0;
+  for (std::size_t frame = 0; frame < framesCount; ++frame) {
+    // Action: Do + 1 to the score, and conditions comparing the score.
+    ReturnVariable(score) += 1;
+    if (ReturnVariable(score) > 1000000) ReturnVariable(score) = 0;
+
+    // Display the score in a text.
+    textLength += GetVariableString(score).size();
+
+    // Action: Do = "Player" to the name, then add a number to it.
+    ReturnVariable(name) = gd::String("Player");
+    ReturnVariable(name) += gd::String::From(frame % 4);
+    textLength += GetVariableString(name).size();
+    if (GetVariableValue(name) > 0) textLength++;
+  }
+
+  return textLength;
+}
+}  // namespace
+
+TEST_CASE("VariablesExtension", "[game-engine]") {
+  SECTION("Number and string actions") {
+    gd::Variable variable;
+    ReturnVariable(variable) = 41;
+    ReturnVariable(variable) += 1;
+    REQUIRE(GetVariableString(variable) == "42");
+    REQUIRE(GetVariableValue(variable) == 42);
+    REQUIRE(variable.IsNumber() == true);
+
+    ReturnVariable(variable) += gd::String("Hello");
+    REQUIRE(GetVariableString(variable) == "42Hello");
+    REQUIRE(GetVariableValue(variable) == 42);
+    REQUIRE(variable.IsNumber() == true);
+
+    // The string is kept when the variable is used as a number.
+    REQUIRE(GetVariableString(variable) == "42Hello");
+    REQUIRE(variable.IsNumber() == false);
+
+    ReturnVariable(variable) = gd::String("3.5");
+    REQUIRE(GetVariableValue(variable) == 3.5);
+    ReturnVariable(variable) *= 2;
+    REQUIRE(GetVariableString(variable) == "7");
+
+    gd::Variable copy = variable;
+    REQUIRE(GetVariableValue(copy) == 7);
+    REQUIRE(GetVariableString(copy) == "7");
+  }
+  SECTION("Same results as the reference") {
+    gd::Variable score, name;
+    ReferenceVariable referenceScore, referenceName;
+    REQUIRE(RunVariablesEvents(score, name, 100) ==
+            RunVariablesEvents(referenceScore, referenceName, 100));
+    REQUIRE(score.GetValue() == referenceScore.GetValue());
+    REQUIRE(name.GetValue() == referenceName.GetValue());
+  }
+}
+
+TEST_CASE("VariablesExtension benchmark", "[.][benchmark]") {
+  auto measure = [](const char* name, std::function<std::size_t()> run) {
+    auto start = std::chrono::steady_clock::now();
+    std::size_t result = run();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << name << ": " << duration.count() << "us" << std::endl;
+    return result;
+  };
+
+  const std::size_t framesCount = 200000;
+  std::size_t expected = measure("Reference", [&]() {
+    ReferenceVariable score, name;
+    return RunVariablesEvents(score, name, framesCount);
+  });
+  REQUIRE(measure("gd::Variable", [&]() {
+            gd::Variable score, name;
+            return RunVariablesEvents(score, name, framesCount);
+          }) == expected);
+}